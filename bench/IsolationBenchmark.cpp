@@ -0,0 +1,114 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <AlgebraicReal.h>
+#include <AliasMonomial.h>
+#include <IsolationStrategy.h>
+#include <UnivariatePolynomial.h>
+
+/*
+  Benchmark of real root isolation strategies
+
+  Print milliseconds of AlgebraicReal::real_roots for each polynomial and each strategy.
+*/
+
+/*
+  Wilkinson-like polynomial of degree n with roots i +- sqrt(2) for i = 1, ..., n / 2.
+  real_roots strips rational roots before isolation, so all roots are irrational to make the strategies isolate them.
+*/
+UnivariatePolynomial<Rational> shifted_wilkinson(const int n)
+{
+  using namespace alias::monomial::rational::x;
+
+  UnivariatePolynomial<Rational> p = 1;
+
+  for (int i = 1; 2 * i <= n; i++)
+  {
+    p *= (x - i) * (x - i) - 2;
+  }
+
+  return p;
+}
+
+// x^n - 2 (kx - 1)^2 has two roots very close to 1/k
+UnivariatePolynomial<Rational> mignotte(const int n, const int k)
+{
+  using namespace alias::monomial::rational::x;
+
+  return x.pow(n) - 2 * (k * x - 1) * (k * x - 1);
+}
+
+// Chebyshev polynomial of the first kind has n roots clustered at -1 and 1
+UnivariatePolynomial<Rational> chebyshev(const int n)
+{
+  using namespace alias::monomial::rational::x;
+
+  UnivariatePolynomial<Rational> previous = 1, current = x;
+
+  for (int i = 1; i < n; i++)
+  {
+    previous = 2 * x * current - previous;
+    std::swap(previous, current);
+  }
+
+  return current;
+}
+
+// Widely spaced irrational roots +-sqrt(2) 10^-k, ..., +-sqrt(2) 10^k
+UnivariatePolynomial<Rational> geometric(const int k)
+{
+  using namespace alias::monomial::rational::x;
+
+  UnivariatePolynomial<Rational> p = x2 - 2;
+  boost::multiprecision::cpp_int power = 1;
+
+  for (int i = 1; i <= k; i++)
+  {
+    power *= 10;
+
+    const Rational square = Rational(power * power, 1);
+
+    p *= (x2 - 2 * square) * (square * x2 - 2);
+  }
+
+  return p;
+}
+
+int main()
+{
+  const std::vector<std::pair<std::string, UnivariatePolynomial<Rational>>> polynomials = {
+      {"shifted Wilkinson 12", shifted_wilkinson(12)},
+      {"Mignotte 15, 30", mignotte(15, 30)},
+      {"Chebyshev 16", chebyshev(16)},
+      {"geometric 4", geometric(4)},
+  };
+
+  const std::vector<std::pair<std::string, IsolationStrategy>> strategies = {
+      {"Sturm", IsolationStrategy::Sturm},
+      {"Descartes", IsolationStrategy::Descartes},
+      {"ContinuedFraction", IsolationStrategy::ContinuedFraction},
+      {"BitstreamDescartes", IsolationStrategy::BitstreamDescartes},
+      {"Aberth", IsolationStrategy::Aberth},
+  };
+
+  std::cout << std::left << std::setw(24) << "polynomial" << std::setw(20) << "strategy" << std::setw(8) << "roots" << "milliseconds" << std::endl;
+
+  for (const auto &[polynomial_name, p] : polynomials)
+  {
+    for (const auto &[strategy_name, strategy] : strategies)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      const auto roots = AlgebraicReal::real_roots(p, strategy);
+      const auto end = std::chrono::steady_clock::now();
+
+      std::cout << std::setw(24) << polynomial_name << std::setw(20) << strategy_name << std::setw(8) << roots.size()
+                << std::chrono::duration<double, std::milli>(end - start).count() << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <tuple>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <FloatingPointHorner.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for numerical seeding of real root isolation by Aberth-Ehrlich iteration.
+*
+*  All complex roots are approximated simultaneously in double by
+*
+*    z_k <- z_k - w_k / (1 - w_k sum_(j != k) 1 / (z_k - z_j))   where w_k = p(z_k) / p'(z_k)
+*
+*  and short dyadic numbers around the midpoints between adjacent approximations of real roots are proposed as separators.
+*  Separators are not certified here: the caller counts roots between them exactly and bisects where the guess fails.
+*
+*  https://en.wikipedia.org/wiki/Aberth_method
+*/
+class AberthIsolation
+{
+private:
+  static constexpr int max_iterations = 500;
+
+  // Iteration stops at z when |p(z)| <= convergence_factor * n * sum |a_i| |z|^i, which is around the rounding error
+  static constexpr double convergence_factor = 0x1p-51;
+
+  // Relative size of imaginary part to take the approximation as a real root
+  static constexpr double real_tolerance = 0x1p-20;
+
+  /*
+  *   Coefficients scaled so that the largest one is around 1. The exponent of too small ones is clamped at -exponent_limit,
+  *   which overestimates them but keeps Horner's rule away from subnormal numbers. The result is only a guess anyway.
+  */
+  static std::vector<double> scaled_coefficients(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    int maximum_exponent = 0;
+
+    for (const auto &each_a : p.a)
+    {
+      if (each_a != 0)
+        maximum_exponent = std::max(maximum_exponent, static_cast<int>(boost::multiprecision::msb(abs(each_a))));
+    }
+
+    std::vector<double> coefficients(p.a.size());
+
+    for (size_t a_i = 0; a_i < p.a.size(); a_i++)
+    {
+      const auto [mantissa, exponent] = FloatingPointHorner::split(p.a.at(a_i));
+
+      coefficients.at(a_i) = p.a.at(a_i).sign() * std::ldexp(mantissa, std::max(exponent - maximum_exponent, -FloatingPointHorner::exponent_limit));
+    }
+
+    return coefficients;
+  }
+
+  // Value, derivative and sum |a_i| |z|^i by Horner's rule
+  static std::tuple<std::complex<double>, std::complex<double>, double> value_and_derivative_at(const std::vector<double> &coefficients, const std::complex<double> z)
+  {
+    std::complex<double> value = coefficients.back(), derivative = 0;
+    double absolute_value = std::abs(coefficients.back());
+
+    const double absolute_z = std::abs(z);
+
+    for (int c_i = coefficients.size() - 2; c_i >= 0; c_i--)
+    {
+      derivative = derivative * z + value;
+      value = value * z + coefficients.at(c_i);
+      absolute_value = absolute_value * absolute_z + std::abs(coefficients.at(c_i));
+    }
+
+    return {value, derivative, absolute_value};
+  }
+
+  // Exact rational value of finite double
+  static Rational exact_rational(const double d)
+  {
+    int exponent;
+    const double mantissa = std::frexp(d, &exponent);
+
+    // mantissa * 2^53 is an integer
+    const boost::multiprecision::cpp_int numerator = static_cast<long long>(std::ldexp(mantissa, 53));
+
+    if (exponent >= 53)
+      return Rational(numerator << (exponent - 53), 1);
+
+    return Rational(numerator, boost::multiprecision::cpp_int(1) << (53 - exponent));
+  }
+
+public:
+  /*
+  *   Approximations of all complex roots with multiplicity.
+  *   Return empty when the iteration doesn't converge or overflows.
+  */
+  static std::vector<std::complex<double>> approximate_roots(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    const int n = p.degree();
+
+    if (n <= 0)
+      return {};
+
+    const std::vector<double> coefficients = scaled_coefficients(p);
+
+    if (coefficients.back() == 0)
+      return {};
+
+    // Initial points on the circle of radius |a_0 / a_n|^(1/n), rotated so that none of them is on the real axis
+    const double radius = coefficients.front() == 0 ? 1 : std::pow(std::abs(coefficients.front() / coefficients.back()), 1.0 / n);
+
+    const double pi = std::acos(-1.0);
+
+    std::vector<std::complex<double>> roots(n);
+
+    for (int k = 0; k < n; k++)
+    {
+      roots.at(k) = std::polar(radius, 2 * pi * k / n + 0.4);
+    }
+
+    // Root whose value is below the rounding error of Horner's rule cannot be improved in double, so it is fixed
+    std::vector<bool> is_converged(n, false);
+
+    for (int iteration = 0; iteration < max_iterations; iteration++)
+    {
+      bool is_all_converged = true;
+
+      for (int k = 0; k < n; k++)
+      {
+        if (is_converged.at(k))
+          continue;
+
+        const auto [value, derivative, absolute_value] = value_and_derivative_at(coefficients, roots.at(k));
+
+        if (std::abs(value) <= convergence_factor * n * absolute_value)
+        {
+          is_converged.at(k) = true;
+          continue;
+        }
+
+        is_all_converged = false;
+
+        const std::complex<double> newton_correction = value / derivative;
+
+        std::complex<double> repulsion = 0;
+
+        for (int j = 0; j < n; j++)
+        {
+          if (j != k)
+            repulsion += 1.0 / (roots.at(k) - roots.at(j));
+        }
+
+        const std::complex<double> correction = newton_correction / (1.0 - newton_correction * repulsion);
+
+        if (!std::isfinite(correction.real()) || !std::isfinite(correction.imag()))
+          return {};
+
+        roots.at(k) -= correction;
+      }
+
+      if (is_all_converged)
+        return roots;
+    }
+
+    return {};
+  }
+
+  /*
+  *   Sorted rational points lower = s_0 < s_1 < ... < s_m = upper which are expected to separate real roots in (lower, upper],
+  *   one root in each (s_(i - 1), s_i]. Return only {lower, upper} when the approximation fails.
+  */
+  static std::vector<Rational> separators(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p, const Rational &lower, const Rational &upper)
+  {
+    std::vector<double> real_roots;
+
+    for (const auto &z : approximate_roots(p))
+    {
+      if (std::abs(z.imag()) <= real_tolerance * std::max(1.0, std::abs(z.real())))
+        real_roots.push_back(z.real());
+    }
+
+    std::sort(real_roots.begin(), real_roots.end());
+
+    std::vector<Rational> points = {lower};
+
+    for (size_t i = 0; i + 1 < real_roots.size(); i++)
+    {
+      const double gap = real_roots.at(i + 1) - real_roots.at(i);
+
+      if (!std::isfinite(gap) || gap == 0)
+        continue;
+
+      // Round the middle to a multiple of 2^k <= gap / 2, which is the shortest dyadic number within gap / 4 from the middle
+      const double step = std::ldexp(1.0, std::ilogb(gap / 2));
+      const double middle = std::round((real_roots.at(i) + gap / 2) / step) * step;
+
+      const Rational separator = exact_rational(middle);
+
+      if (points.back() < separator && separator < upper)
+        points.push_back(separator);
+    }
+
+    points.push_back(upper);
+
+    return points;
+  }
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <ostream>
+
+#include <boost/operators.hpp>
+
+#include <AlgebraicReal.h>
+#include <IntervalRational.h>
+#include <Rational.h>
+
+/*
+  Class for lazy arithmetic expression of algebraic reals:
+
+  Arithmetic only records a node of the expression DAG, and subexpressions are shared between copies.
+  Sign and comparison are decided from interval evaluation with leaves refined to increasing precision.
+  When the interval keeps containing zero, the measure bound |E| >= 1 / M(E) for non-zero E (Mignotte) decides zero,
+  and defining polynomials are computed by AlgebraicReal arithmetic only when the bound needs more precision than allowed.
+*/
+class AlgebraicExpr : private boost::ordered_field_operators<AlgebraicExpr>
+{
+private:
+  struct Node;
+
+  std::shared_ptr<const Node> node;
+
+  explicit AlgebraicExpr(const std::shared_ptr<const Node> &node) : node(node){};
+
+  // Leaf precision (in bits) of the first interval evaluation, which is doubled on each failure
+  static constexpr int initial_precision = 32;
+  // Interval evaluation gives up beyond this leaf precision (in bits) and the expression is materialized
+  static constexpr int max_precision = 4096;
+
+public:
+  // Zero
+  AlgebraicExpr();
+  AlgebraicExpr(const int n);
+  AlgebraicExpr(const Rational &r);
+  AlgebraicExpr(const AlgebraicReal &a);
+
+  AlgebraicExpr operator+() const;
+  AlgebraicExpr operator-() const;
+
+  AlgebraicExpr &operator+=(const AlgebraicExpr &e);
+  AlgebraicExpr &operator-=(const AlgebraicExpr &e);
+  AlgebraicExpr &operator*=(const AlgebraicExpr &e);
+  AlgebraicExpr &operator/=(const AlgebraicExpr &e);
+
+  friend bool operator<(const AlgebraicExpr &e1, const AlgebraicExpr &e2);
+  friend bool operator==(const AlgebraicExpr &e1, const AlgebraicExpr &e2);
+
+  friend std::ostream &operator<<(std::ostream &os, const AlgebraicExpr &e);
+
+  /*
+  *   Interval containing the value, evaluated with each leaf refined to width at most 2^(-precision).
+  *   Return no value when an interval of a divisor contains zero.
+  */
+  std::optional<IntervalRational> evaluate(const int precision) const;
+
+  /*
+  *   Upper bound of log2 M(E) where M(E) is the Mahler measure of an integer polynomial vanishing at the value,
+  *   from the measures of the leaves. Non-zero value has |E| >= 2^(-bound).
+  */
+  double separation_bits() const;
+
+  int sign() const;
+
+  // Value computed by AlgebraicReal arithmetic. The result of each node is cached, so shared subexpressions are computed once.
+  AlgebraicReal materialize() const;
+
+  // Number of nodes whose value was computed by AlgebraicReal arithmetic since the last reset, to observe how often intervals are not enough
+  static unsigned long long materialization_count();
+  static void reset_materialization_count();
+};
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <functional>
+#include <optional>
 #include <stdexcept>
 
 #include <IntervalRational.h>
+#include <IsolationStrategy.h>
 #include <Rational.h>
 #include <SturmSequence.h>
 #include <UnivariatePolynomial.h>
 
+class TaskGroup;
+
 /*
   Class for algebraic real number:
 
@@ -34,6 +39,29 @@ private:
 
   AlgebraicReal just_one_root(const std::vector<AlgebraicReal> roots) const;
 
+  /*
+  *   One step of quadratic interval refinement with subinterval_count = N:
+  *   the secant of the defining polynomial guesses which of N subintervals contains the root.
+  *   Return no value when the guess misses, then the interval should be bisected.
+  */
+  std::optional<IntervalRational> quadratic_refinement_step(const IntervalRational &ivr, const boost::multiprecision::cpp_int &subinterval_count) const;
+
+  // Target width for the next round of refinement loop: halve a wide interval and double the precision (bits) of a narrow one
+  static Rational next_target_width(const Rational &width);
+
+  // Bisection is split into parallel tasks only for intervals with at least this many roots
+  static constexpr int parallel_root_count = 4;
+  // and only up to this depth, so that deep clusters of roots are isolated in one task
+  static constexpr int parallel_depth = 12;
+
+  // Write the roots into consecutive slots from roots, which is given by the number of roots left to the interval
+  static void bisect_roots_into(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> interval, const std::pair<int, int> interval_sign_change,
+                                const int depth, const std::vector<std::optional<AlgebraicReal>>::iterator roots, TaskGroup &group);
+
+  // Isolate real roots in (e1, e2] of square-free polynomial without rational roots by the strategy
+  static std::vector<AlgebraicReal> isolate_real_roots(const UnivariatePolynomial<Rational> &square_free_polynomial, const Extended<Rational> &e1, const Extended<Rational> &e2,
+                                                       const IsolationStrategy strategy);
+
 public:
   // Zero
   AlgebraicReal();
@@ -43,6 +71,8 @@ public:
   AlgebraicReal(const Rational &r);
   // Define by univariate polynomial and interval
   AlgebraicReal(const UnivariatePolynomial<Rational> &defining_polynomial, const std::pair<Rational, Rational> &interval);
+  // Define by Sturm sequence of the defining polynomial and interval, reusing the sequence instead of computing it again
+  AlgebraicReal(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> &interval);
 
   AlgebraicReal operator+() const;
   AlgebraicReal operator-() const;
@@ -70,9 +100,44 @@ public:
   IntervalRational next_interval(const IntervalRational old_interval) const;
   // Diminish interval without Sturm sequence but derivative sign
   IntervalRational next_interval_with_sign(const IntervalRational &ivr) const;
+  /*
+  * Narrow interval until its width is at most given width by quadratic interval refinement (Abbott's QIR).
+  * It converges quadratically and falls back to bisection when the secant guess misses.
+  * Result is a point interval when a rational root is hit. Throw when width is not positive.
+  */
+  IntervalRational refine_to(const Rational &width) const;
+  IntervalRational refine_to(const IntervalRational &ivr, const Rational &width) const;
+  /*
+  * Same with N of QIR passed in and out, so that a loop refining the same interval again keeps the reached N
+  * instead of restarting from initial_subinterval_count.
+  */
+  IntervalRational refine_to(const IntervalRational &ivr, const Rational &width, boost::multiprecision::cpp_int &subinterval_count) const;
+
+  // N of QIR for the first refinement of an interval, which is also the minimum
+  static constexpr int initial_subinterval_count = 4;
 
-  static std::vector<AlgebraicReal> real_roots(const UnivariatePolynomial<Rational> &p);
-  static std::vector<AlgebraicReal> real_roots_between(const UnivariatePolynomial<Rational> &p, const Extended<Rational> &e1, const Extended<Rational> &e2);
+  static std::vector<AlgebraicReal> real_roots(const UnivariatePolynomial<Rational> &p, const IsolationStrategy strategy = IsolationStrategy::Sturm);
+  // Real roots whose intervals are refined to width at most precision (> 0), in parallel tasks
+  static std::vector<AlgebraicReal> real_roots(const UnivariatePolynomial<Rational> &p, const Rational &precision, const IsolationStrategy strategy = IsolationStrategy::Sturm);
+  static std::vector<AlgebraicReal> real_roots_between(const UnivariatePolynomial<Rational> &p, const Extended<Rational> &e1, const Extended<Rational> &e2,
+                                                       const IsolationStrategy strategy = IsolationStrategy::Sturm);
+  /*
+  * Real roots of many polynomials, in input order. Polynomials equal up to a constant factor are isolated once,
+  * and each distinct polynomial is isolated in a task of the shared task pool.
+  */
+  static std::vector<std::vector<AlgebraicReal>> real_roots_batch(const std::vector<UnivariatePolynomial<Rational>> &polynomials,
+                                                                  const IsolationStrategy strategy = IsolationStrategy::Sturm);
+  // Stream roots of each input through callback(index, roots) as they complete. Calls of callback are serialized.
+  static void real_roots_batch(const std::vector<UnivariatePolynomial<Rational>> &polynomials,
+                               const std::function<void(const size_t, const std::vector<AlgebraicReal> &)> &callback,
+                               const IsolationStrategy strategy = IsolationStrategy::Sturm);
+  /*
+  * Real roots of all polynomials in increasing order, each tagged with indices of the input polynomials vanishing there.
+  * Roots are isolated once for each element of a coprime basis of the inputs, and isolating intervals are refined
+  * until rationals separate them, so the roots are merged without comparing algebraic numbers.
+  */
+  static std::vector<std::pair<AlgebraicReal, std::vector<size_t>>> merged_real_roots(const std::vector<UnivariatePolynomial<Rational>> &polynomials,
+                                                                                      const IsolationStrategy strategy = IsolationStrategy::Sturm);
   static std::vector<AlgebraicReal> bisect_roots(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> interval, const std::pair<int, int> interval_sign_change);
 
   int sign() const;
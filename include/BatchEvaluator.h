@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <FilteredPolynomial.h>
+#include <FloatingPointHorner.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for evaluation of a polynomial at many points, for plotting, sampling and filter stages.
+*
+*  The polynomial is c q for a primitive integer polynomial q and c > 0. The double image of q is scaled by a power of two
+*  as in FilteredPolynomial, so coefficients of any size are approximated. Points are evaluated together by FloatingPointHorner,
+*  in AVX-512 or AVX2 lanes when enabled, and each result has a certified error bound.
+*/
+class BatchEvaluator
+{
+private:
+  FilteredPolynomial filtered_polynomial;
+
+  // c = factor_mantissa * 2^factor_exponent where factor_mantissa in [1/2, 2] has relative error rational_error. Zero for zero polynomial.
+  double factor_mantissa = 0;
+  int factor_exponent = 0;
+
+  // Bound of the image moved outward in direction (-1 or +1) and multiplied by c, covering error of c and all rounding
+  double scaled_bound(const double image_bound, const double direction) const
+  {
+    const double product = std::nextafter(image_bound, direction * HUGE_VAL) * factor_mantissa;
+    const double widened = std::nextafter(product + direction * std::abs(product) * 2 * FloatingPointHorner::rational_error, direction * HUGE_VAL);
+
+    return std::nextafter(std::ldexp(widened, factor_exponent + filtered_polynomial.image_scale()), direction * HUGE_VAL);
+  }
+
+public:
+  BatchEvaluator(const UnivariatePolynomial<Rational> &p) : filtered_polynomial(p)
+  {
+    if (p == 0)
+      return;
+
+    const Rational factor = p.leading_coefficient() / Rational(filtered_polynomial.integer().leading_coefficient(), 1);
+
+    factor_exponent = static_cast<int>(boost::multiprecision::msb(abs(factor.get_numerator()))) - static_cast<int>(boost::multiprecision::msb(abs(factor.get_denominator())));
+
+    const Rational power = Rational(boost::multiprecision::cpp_int(1) << std::abs(factor_exponent), 1);
+
+    factor_mantissa = FloatingPointHorner::approximate(factor_exponent >= 0 ? factor / power : factor * power);
+  }
+
+  /*
+  *   Enclosure [lower, upper] of the value at each point.
+  *   The enclosure is rounded outward, and it is (-inf, inf) when the evaluation or the value overflows.
+  */
+  std::vector<std::pair<double, double>> enclose_at(const std::vector<double> &points) const
+  {
+    if (factor_mantissa == 0)
+      return std::vector<std::pair<double, double>>(points.size(), {0, 0});
+
+    std::vector<std::pair<double, double>> enclosures(points.size(), {-HUGE_VAL, HUGE_VAL});
+
+    std::vector<double> values, error_bounds;
+
+    filtered_polynomial.evaluate_image(points, 0, values, error_bounds);
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+      if (!std::isfinite(error_bounds.at(i)))
+        continue;
+
+      const double lower = scaled_bound(values.at(i) - error_bounds.at(i), -1);
+      const double upper = scaled_bound(values.at(i) + error_bounds.at(i), 1);
+
+      if (std::isfinite(lower) && std::isfinite(upper))
+        enclosures.at(i) = {lower, upper};
+    }
+
+    return enclosures;
+  }
+
+  // Sign at each rational point. Point whose enclosure contains zero is evaluated exactly by integer Horner's rule.
+  std::vector<int> sign_at(const std::vector<Rational> &points) const
+  {
+    if (factor_mantissa == 0)
+      return std::vector<int>(points.size(), 0);
+
+    // c > 0, so the sign is the one of q
+    return filtered_polynomial.sign_at(points);
+  }
+};
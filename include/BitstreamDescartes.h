@@ -0,0 +1,371 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <DescartesIsolation.h>
+#include <IntegerPolynomial.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for real root isolation by bitstream Descartes method, for polynomials with huge coefficients.
+*
+*  It runs the same bisection as DescartesIsolation, but each node keeps only a few leading bits of its coefficients:
+*  every coefficient c is replaced by the integer interval [floor(c / 2^s), ceil(c / 2^s)].
+*  Taylor shift, scaling and reversal are sums with non-negative factors, so lower and upper bounds are transformed separately.
+*  When some sign cannot be decided from the bounds, the node is recomputed from its exact coefficients with doubled precision.
+*  They are computed once per node, from the ones of its parent when known, so further doublings only truncate them.
+*  Cost depends on how many bits are needed to separate the roots, not on the size of the coefficients.
+*
+*  Isolating intervals are certified exactly by signs of the polynomial at their ends.
+*
+*  https://doi.org/10.1007/978-3-540-85521-7_1 (Eigenwillig, Real root isolation for exact and approximate polynomials using Descartes' rule of signs)
+*/
+class BitstreamDescartes
+{
+private:
+  typedef std::vector<boost::multiprecision::cpp_int> Coefficients;
+
+  // Subinterval (lower + width * numerator / 2^depth, lower + width * (numerator + 1) / 2^depth) with bounds of its coefficients
+  struct Node
+  {
+    Coefficients lower_coefficients, upper_coefficients;
+    boost::multiprecision::cpp_int numerator;
+    int depth;
+    int precision;
+    // Left or right end is a root of p. The root at the left end is divided out from the coefficients.
+    bool has_root_at_left, has_root_at_right;
+    // Node only to report the root at its left end
+    bool is_root;
+    // Exact coefficients, computed when the bounds first fail and kept so that doubling precision only truncates them again
+    std::shared_ptr<const Coefficients> exact_coefficients;
+    // Exact coefficients of the parent when it had them, from which the ones of this node follow by one halving and shift
+    std::shared_ptr<const Coefficients> parent_exact_coefficients;
+  };
+
+  static constexpr int initial_precision = 64;
+
+  static int bit_length(const Coefficients &coefficients)
+  {
+    int length = 0;
+
+    for (const auto &each_c : coefficients)
+    {
+      if (each_c != 0)
+        length = std::max(length, static_cast<int>(boost::multiprecision::msb(abs(each_c))) + 1);
+    }
+
+    return length;
+  }
+
+  // floor(c / 2^shift) or ceil(c / 2^shift)
+  static boost::multiprecision::cpp_int round_shift(const boost::multiprecision::cpp_int &c, const int shift, const bool is_ceil)
+  {
+    const boost::multiprecision::cpp_int divisor = boost::multiprecision::cpp_int(1) << shift;
+    boost::multiprecision::cpp_int quotient = c / divisor;
+
+    if (quotient * divisor != c)
+    {
+      // Division truncates toward zero
+      if (c < 0 && !is_ceil)
+        quotient -= 1;
+      else if (c > 0 && is_ceil)
+        quotient += 1;
+    }
+
+    return quotient;
+  }
+
+  // Drop low bits of both bounds so that the larger one has about precision bits
+  static void truncate(Coefficients &lower_coefficients, Coefficients &upper_coefficients, const int precision)
+  {
+    const int shift = std::max(bit_length(lower_coefficients), bit_length(upper_coefficients)) - precision;
+
+    if (shift <= 0)
+      return;
+
+    for (size_t i = 0; i < lower_coefficients.size(); i++)
+    {
+      lower_coefficients.at(i) = round_shift(lower_coefficients.at(i), shift, false);
+      upper_coefficients.at(i) = round_shift(upper_coefficients.at(i), shift, true);
+    }
+  }
+
+  // c_i -> c_i 2^(n - i), that is 2^n q(x / 2)
+  static void half_argument(Coefficients &coefficients)
+  {
+    const int degree = coefficients.size() - 1;
+
+    for (int i = 0; i < degree; i++)
+    {
+      coefficients.at(i) <<= degree - i;
+    }
+  }
+
+  // q(x + 1)
+  static void taylor_shift_by_one(Coefficients &coefficients)
+  {
+    const int degree = coefficients.size() - 1;
+
+    for (int i = 0; i < degree; i++)
+    {
+      for (int j = degree - 1; j >= i; j--)
+      {
+        coefficients.at(j) += coefficients.at(j + 1);
+      }
+    }
+  }
+
+  // (x + 1)^n q(1 / (x + 1)), whose sign variations bound the number of roots in (0, 1)
+  static Coefficients descartes_transform(const Coefficients &coefficients)
+  {
+    Coefficients transformed(coefficients.rbegin(), coefficients.rend());
+
+    taylor_shift_by_one(transformed);
+
+    return transformed;
+  }
+
+  // Sign variations of coefficients given by bounds. Return no value when some sign is not decided.
+  static std::optional<int> sign_variations(const Coefficients &lower_coefficients, const Coefficients &upper_coefficients)
+  {
+    int count = 0, last_sign = 0;
+
+    for (size_t i = 0; i < lower_coefficients.size(); i++)
+    {
+      int each_sign;
+
+      if (lower_coefficients.at(i) > 0)
+        each_sign = 1;
+      else if (upper_coefficients.at(i) < 0)
+        each_sign = -1;
+      else if (lower_coefficients.at(i) == 0 && upper_coefficients.at(i) == 0)
+        each_sign = 0;
+      else
+        return std::nullopt;
+
+      if (each_sign == 0)
+        continue;
+
+      if (last_sign * each_sign < 0)
+        count++;
+
+      last_sign = each_sign;
+    }
+
+    return count;
+  }
+
+  /*
+  *  Exact coefficients of node, derived from the ones of its parent when they are known and otherwise by Taylor shift
+  *  of the exact polynomial on the unit interval. Right children have odd numerators.
+  */
+  static Coefficients exact_node_coefficients(const Node &node, const UnivariatePolynomial<boost::multiprecision::cpp_int> &unit_polynomial)
+  {
+    const bool is_right_child = boost::multiprecision::bit_test(node.numerator, 0);
+
+    if (node.parent_exact_coefficients)
+    {
+      Coefficients exact_coefficients = *node.parent_exact_coefficients;
+
+      half_argument(exact_coefficients);
+
+      if (is_right_child)
+        taylor_shift_by_one(exact_coefficients);
+
+      // Root at the left end of a left child is the one of its parent, which is already divided out
+      if (node.has_root_at_left && is_right_child)
+        exact_coefficients.erase(exact_coefficients.begin());
+
+      return exact_coefficients;
+    }
+
+    Coefficients exact_coefficients = unit_polynomial.a;
+
+    const int degree = exact_coefficients.size() - 1;
+
+    for (int i = 0; i < degree; i++)
+    {
+      exact_coefficients.at(i) <<= node.depth * (degree - i);
+    }
+
+    if (node.numerator != 0)
+      exact_coefficients = IntegerPolynomial::taylor_shift(UnivariatePolynomial<boost::multiprecision::cpp_int>(exact_coefficients), node.numerator).a;
+
+    if (node.has_root_at_left)
+      exact_coefficients.erase(exact_coefficients.begin());
+
+    return exact_coefficients;
+  }
+
+  // Recompute the bounds of node from its exact coefficients at its precision
+  static void approximate_node(Node &node, const UnivariatePolynomial<boost::multiprecision::cpp_int> &unit_polynomial)
+  {
+    if (!node.exact_coefficients)
+    {
+      node.exact_coefficients = std::make_shared<const Coefficients>(exact_node_coefficients(node, unit_polynomial));
+      node.parent_exact_coefficients.reset();
+    }
+
+    node.lower_coefficients = *node.exact_coefficients;
+    node.upper_coefficients = *node.exact_coefficients;
+
+    truncate(node.lower_coefficients, node.upper_coefficients, node.precision);
+  }
+
+  // Exact check that (lower, upper] contains exactly one root of square-free p, which has one by the rule of signs
+  static bool certify(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p, const Rational &lower, const Rational &upper)
+  {
+    const int sign_at_upper = IntegerPolynomial::sign_at(p, upper);
+    int sign_at_lower = IntegerPolynomial::sign_at(p, lower);
+
+    // Just right of a simple root at lower, p has the sign of p'
+    if (sign_at_lower == 0)
+      sign_at_lower = IntegerPolynomial::sign_at(p.differential(), lower);
+
+    return sign_at_lower * sign_at_upper < 0;
+  }
+
+  static std::pair<boost::multiprecision::cpp_int, boost::multiprecision::cpp_int> normalize(const Rational &r)
+  {
+    if (r.get_denominator() < 0)
+      return {-r.get_numerator(), -r.get_denominator()};
+
+    return {r.get_numerator(), r.get_denominator()};
+  }
+
+public:
+  /*
+  *   Isolating intervals of the roots of square-free p in (lower, upper], in ascending order.
+  *   Each interval (r1, r2] contains exactly one root and p(r2) is not zero, or it is (r, r) for rational root r.
+  */
+  static std::vector<std::pair<Rational, Rational>> isolate(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p, const Rational &lower, const Rational &upper)
+  {
+    if (p.degree() <= 0 || !(lower < upper))
+      return {};
+
+    const auto [lower_numerator, lower_denominator] = normalize(lower);
+    const auto [upper_numerator, upper_denominator] = normalize(upper);
+
+    const UnivariatePolynomial<boost::multiprecision::cpp_int> unit_polynomial =
+        IntegerPolynomial::remove_power_of_two_content(IntegerPolynomial::compose_mobius(p,
+                                                                                         upper_numerator * lower_denominator - lower_numerator * upper_denominator,
+                                                                                         lower_numerator * upper_denominator,
+                                                                                         0,
+                                                                                         lower_denominator * upper_denominator));
+
+    const Rational width = upper - lower;
+
+    const auto endpoint = [&lower, &width](const boost::multiprecision::cpp_int &numerator, const int depth)
+    {
+      return lower + width * Rational(numerator, boost::multiprecision::cpp_int(1) << depth);
+    };
+
+    const bool is_upper_root = IntegerPolynomial::sign_at(p, upper) == 0;
+
+    Node initial_node = {{}, {}, 0, 0, initial_precision + 2 * p.degree(), IntegerPolynomial::sign_at(p, lower) == 0, is_upper_root, false, nullptr, nullptr};
+    approximate_node(initial_node, unit_polynomial);
+
+    std::vector<std::pair<Rational, Rational>> intervals;
+
+    std::vector<Node> stack = {initial_node};
+
+    while (!stack.empty())
+    {
+      Node node = std::move(stack.back());
+      stack.pop_back();
+
+      const Rational left = endpoint(node.numerator, node.depth);
+
+      if (node.is_root)
+      {
+        intervals.push_back({left, left});
+        continue;
+      }
+
+      auto lower_transformed = descartes_transform(node.lower_coefficients);
+      auto upper_transformed = descartes_transform(node.upper_coefficients);
+
+      // Root at the right end makes the constant term exactly zero
+      if (node.has_root_at_right)
+      {
+        lower_transformed.at(0) = 0;
+        upper_transformed.at(0) = 0;
+      }
+
+      const auto variations = sign_variations(lower_transformed, upper_transformed);
+
+      if (!variations)
+      {
+        node.precision *= 2;
+        approximate_node(node, unit_polynomial);
+        stack.push_back(std::move(node));
+        continue;
+      }
+
+      if (*variations == 0)
+        continue;
+
+      if (*variations == 1 && !node.has_root_at_right)
+      {
+        const Rational right = endpoint(node.numerator + 1, node.depth);
+
+        if (certify(p, left, right))
+        {
+          intervals.push_back({left, right});
+        }
+        else
+        {
+          // Never happens with correct bounds, but isolate exactly rather than return a wrong interval
+          const auto exact_intervals = DescartesIsolation::isolate(p, left, right);
+          intervals.insert(intervals.end(), exact_intervals.begin(), exact_intervals.end());
+        }
+
+        continue;
+      }
+
+      Node left_node = {node.lower_coefficients, node.upper_coefficients, 2 * node.numerator, node.depth + 1, node.precision, node.has_root_at_left, false, false, nullptr, node.exact_coefficients};
+
+      half_argument(left_node.lower_coefficients);
+      half_argument(left_node.upper_coefficients);
+
+      Node right_node = {left_node.lower_coefficients, left_node.upper_coefficients, 2 * node.numerator + 1, node.depth + 1, node.precision, false, node.has_root_at_right, false, nullptr, node.exact_coefficients};
+
+      taylor_shift_by_one(right_node.lower_coefficients);
+      taylor_shift_by_one(right_node.upper_coefficients);
+
+      // Constant term is the value at the middle, so the middle is exactly checked only when its bounds contain zero
+      const Rational middle = endpoint(right_node.numerator, right_node.depth);
+      const bool is_middle_root = right_node.lower_coefficients.at(0) <= 0 && 0 <= right_node.upper_coefficients.at(0) && IntegerPolynomial::sign_at(p, middle) == 0;
+
+      if (is_middle_root)
+      {
+        right_node.lower_coefficients.erase(right_node.lower_coefficients.begin());
+        right_node.upper_coefficients.erase(right_node.upper_coefficients.begin());
+        right_node.has_root_at_left = true;
+        left_node.has_root_at_right = true;
+      }
+
+      truncate(left_node.lower_coefficients, left_node.upper_coefficients, left_node.precision);
+      truncate(right_node.lower_coefficients, right_node.upper_coefficients, right_node.precision);
+
+      stack.push_back(std::move(right_node));
+
+      if (is_middle_root)
+        stack.push_back({{}, {}, 2 * node.numerator + 1, node.depth + 1, node.precision, false, false, true, nullptr, nullptr});
+
+      stack.push_back(std::move(left_node));
+    }
+
+    if (is_upper_root)
+      intervals.push_back({upper, upper});
+
+    return intervals;
+  }
+};
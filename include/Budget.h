@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+/*
+*  Flag to cancel a computation from another thread. Copies share the flag.
+*/
+class CancellationToken
+{
+private:
+  std::shared_ptr<std::atomic<bool>> is_cancelled_flag = std::make_shared<std::atomic<bool>>(false);
+
+public:
+  void cancel() const;
+  bool is_cancelled() const;
+};
+
+/*
+*  Thrown by Budget::charge() when the budget of current thread is over, so the caller can tell it from a domain error.
+*/
+class BudgetExhausted : public std::runtime_error
+{
+public:
+  enum class Reason
+  {
+    Steps,    // Number of steps exceeded the limit
+    Time,     // Deadline passed
+    Cancelled // Token was cancelled
+  };
+
+private:
+  Reason exhaustion_reason;
+
+public:
+  explicit BudgetExhausted(const Reason reason);
+
+  Reason reason() const;
+};
+
+/*
+*  Limit of steps and time of exact computation with cooperative cancellation.
+*
+*  Budget::Scope installs a budget for the current thread, and tasks run by TaskGroup inherit the budget of the thread submitting them.
+*  Long loops and recursions of the library (bisection, refinement, resultant and remainder sequences) call Budget::charge()
+*  at each step, which throws BudgetExhausted when the installed budget is over. Without a budget, charge() does nothing.
+*/
+class Budget
+{
+private:
+  const std::optional<unsigned long long> max_steps;
+  const std::optional<std::chrono::steady_clock::time_point> deadline;
+  const CancellationToken token;
+
+  std::atomic<unsigned long long> used_steps{0};
+
+  static thread_local Budget *current_budget;
+
+  // Throw BudgetExhausted when this budget is over after using steps
+  void consume(const unsigned long long steps);
+
+public:
+  explicit Budget(const std::optional<unsigned long long> max_steps,
+                  const std::optional<std::chrono::steady_clock::duration> max_time = std::nullopt,
+                  const CancellationToken token = CancellationToken());
+
+  Budget(const Budget &) = delete;
+  Budget &operator=(const Budget &) = delete;
+
+  // Number of steps charged so far
+  unsigned long long steps() const;
+
+  // Budget installed for current thread, or nullptr
+  static Budget *current();
+
+  // Charge steps to the budget of current thread
+  static void charge(const unsigned long long steps = 1);
+
+  /*
+  *  Install a budget for current thread while the scope lives. The previous one is restored at the end.
+  *  nullptr runs without budget.
+  */
+  class Scope
+  {
+  private:
+    Budget *previous_budget;
+
+  public:
+    explicit Scope(Budget *budget);
+    explicit Scope(Budget &budget) : Scope(&budget){};
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    ~Scope();
+  };
+};
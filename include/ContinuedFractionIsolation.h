@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <IntegerPolynomial.h>
+#include <Rational.h>
+#include <RootBound.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for real root isolation by continued fractions (Vincent-Akritas-Strzebonski).
+*
+*  Each node keeps q(x) = (cx + d)^n p((ax + b) / (cx + d)) whose positive roots correspond to the roots of p
+*  between b / d and a / c. The number of sign variations of q bounds the number of positive roots.
+*  Instead of halving, the node is moved by a lower bound s of positive roots (x -> x + s),
+*  and then split at 1 into x -> x + 1 and x -> 1 / (1 + x).
+*  A large step skips a wide gap at once, so it is fast for clustered or widely spaced roots.
+*
+*  https://en.wikipedia.org/wiki/Vincent%27s_theorem
+*/
+class ContinuedFractionIsolation
+{
+private:
+  // Polynomial with Mobius transformation (ax + b) / (cx + d) which maps its positive roots to the roots of p
+  struct Node
+  {
+    UnivariatePolynomial<boost::multiprecision::cpp_int> polynomial;
+    boost::multiprecision::cpp_int a, b, c, d;
+  };
+
+  // Divide by x when 0 is a root, and return whether it was
+  static bool remove_zero_root(UnivariatePolynomial<boost::multiprecision::cpp_int> &q)
+  {
+    if (q.a.size() == 0 || q.a.at(0) != 0)
+      return false;
+
+    q = UnivariatePolynomial<boost::multiprecision::cpp_int>(std::vector<boost::multiprecision::cpp_int>(q.a.begin() + 1, q.a.end()));
+
+    return true;
+  }
+
+  // Numerator and positive denominator
+  static std::pair<boost::multiprecision::cpp_int, boost::multiprecision::cpp_int> normalize(const Rational &r)
+  {
+    if (r.get_denominator() < 0)
+      return {-r.get_numerator(), -r.get_denominator()};
+
+    return {r.get_numerator(), r.get_denominator()};
+  }
+
+public:
+  /*
+  *   Isolating intervals of the roots of square-free p in (lower, upper], in ascending order.
+  *   Each interval (r1, r2] contains exactly one root and p(r2) is not zero, or it is (r, r) for rational root r.
+  */
+  static std::vector<std::pair<Rational, Rational>> isolate(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p, const Rational &lower, const Rational &upper)
+  {
+    if (p.degree() <= 0 || !(lower < upper))
+      return {};
+
+    const auto [lower_numerator, lower_denominator] = normalize(lower);
+    const auto [upper_numerator, upper_denominator] = normalize(upper);
+
+    // (upper x + lower) / (x + 1) maps (0, oo) onto (lower, upper)
+    Node initial_node = {{},
+                         upper_numerator * lower_denominator,
+                         lower_numerator * upper_denominator,
+                         lower_denominator * upper_denominator,
+                         lower_denominator * upper_denominator};
+
+    initial_node.polynomial = IntegerPolynomial::compose_mobius(p, initial_node.a, initial_node.b, initial_node.c, initial_node.d);
+
+    // Root at lower is out of (lower, upper]
+    remove_zero_root(initial_node.polynomial);
+
+    std::vector<std::pair<Rational, Rational>> intervals;
+
+    std::vector<Node> stack = {initial_node};
+
+    while (!stack.empty())
+    {
+      Node node = std::move(stack.back());
+      stack.pop_back();
+
+      auto &[q, a, b, c, d] = node;
+
+      const int variations = IntegerPolynomial::sign_variations(q);
+
+      if (variations == 0)
+        continue;
+
+      if (variations == 1)
+      {
+        const Rational zero_end(b, d), infinity_end(a, c);
+        const std::pair<Rational, Rational> interval = std::minmax(zero_end, infinity_end);
+
+        // Right end must not be a root for half-open interval, so split further when it is
+        if (IntegerPolynomial::sign_at(p, interval.second) != 0)
+        {
+          intervals.push_back(interval);
+          continue;
+        }
+      }
+
+      // All positive roots are at least 2^(-e) where 2^e bounds the positive roots of x^n q(1/x)
+      const auto reverse_exponent = RootBound::local_max_exponent(IntegerPolynomial::reverse(q));
+
+      if (reverse_exponent && *reverse_exponent < 0)
+      {
+        const boost::multiprecision::cpp_int shift = boost::multiprecision::cpp_int(1) << -*reverse_exponent;
+
+        q = IntegerPolynomial::remove_power_of_two_content(IntegerPolynomial::taylor_shift(q, shift));
+        b += a * shift;
+        d += c * shift;
+
+        if (remove_zero_root(q))
+          intervals.push_back({Rational(b, d), Rational(b, d)});
+
+        stack.push_back(std::move(node));
+        continue;
+      }
+
+      // x -> x + 1 for roots greater than 1
+      Node greater_node = {IntegerPolynomial::taylor_shift(q, 1), a, a + b, c, c + d};
+
+      if (remove_zero_root(greater_node.polynomial))
+        intervals.push_back({Rational(a + b, c + d), Rational(a + b, c + d)});
+
+      // x -> 1 / (1 + x) for roots less than 1. The root at 1 is already reported.
+      Node less_node = {IntegerPolynomial::taylor_shift(IntegerPolynomial::reverse(q), 1), b, a + b, d, c + d};
+
+      remove_zero_root(less_node.polynomial);
+
+      stack.push_back(std::move(greater_node));
+      stack.push_back(std::move(less_node));
+    }
+
+    if (IntegerPolynomial::sign_at(p, upper) == 0)
+      intervals.push_back({upper, upper});
+
+    std::sort(intervals.begin(), intervals.end());
+
+    return intervals;
+  }
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <IntegerPolynomial.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for real root isolation by Descartes' rule of signs (Vincent-Collins-Akritas bisection).
+*
+*  The polynomial is mapped onto the unit interval as q(x) = p(lower + (upper - lower) x).
+*  The number of sign variations of (x + 1)^n q(1 / (x + 1)) bounds the number of roots in (0, 1),
+*  and it is exact when it is 0 or 1. Otherwise (0, 1) is split by Taylor shifts on integer coefficients:
+*
+*    left half:  2^n q(x / 2)
+*    right half: 2^n q((x + 1) / 2)
+*
+*  It needs neither remainder sequence nor rational arithmetic.
+*
+*  https://en.wikipedia.org/wiki/Real-root_isolation#Bisection_method
+*/
+class DescartesIsolation
+{
+private:
+  // Subinterval (lower + width * numerator / 2^depth, lower + width * (numerator + 1) / 2^depth) with its polynomial
+  struct Node
+  {
+    UnivariatePolynomial<boost::multiprecision::cpp_int> polynomial;
+    boost::multiprecision::cpp_int numerator;
+    int depth;
+    // Node only to report the root at its left end
+    bool is_root;
+  };
+
+  // Upper bound of the number of roots in (0, 1), which is exact when it is 0 or 1
+  static int count_variations_in_unit_interval(const UnivariatePolynomial<boost::multiprecision::cpp_int> &q)
+  {
+    return IntegerPolynomial::sign_variations(IntegerPolynomial::taylor_shift(IntegerPolynomial::reverse(q), 1));
+  }
+
+  // Value at 1, which is sum of coefficients
+  static boost::multiprecision::cpp_int value_at_one(const UnivariatePolynomial<boost::multiprecision::cpp_int> &q)
+  {
+    boost::multiprecision::cpp_int sum = 0;
+
+    for (const auto &each_a : q.a)
+    {
+      sum += each_a;
+    }
+
+    return sum;
+  }
+
+  // Numerator and positive denominator
+  static std::pair<boost::multiprecision::cpp_int, boost::multiprecision::cpp_int> normalize(const Rational &r)
+  {
+    if (r.get_denominator() < 0)
+      return {-r.get_numerator(), -r.get_denominator()};
+
+    return {r.get_numerator(), r.get_denominator()};
+  }
+
+public:
+  /*
+  *   Isolating intervals of the roots of square-free p in (lower, upper], in ascending order.
+  *   Each interval (r1, r2] contains exactly one root and p(r2) is not zero, or it is (r, r) for rational root r.
+  */
+  static std::vector<std::pair<Rational, Rational>> isolate(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p, const Rational &lower, const Rational &upper)
+  {
+    if (p.degree() <= 0 || !(lower < upper))
+      return {};
+
+    const auto [lower_numerator, lower_denominator] = normalize(lower);
+    const auto [upper_numerator, upper_denominator] = normalize(upper);
+
+    // lower + (upper - lower) x = (l1 u2 + (u1 l2 - l1 u2) x) / (l2 u2)
+    const UnivariatePolynomial<boost::multiprecision::cpp_int> unit_polynomial =
+        IntegerPolynomial::compose_mobius(p,
+                                          upper_numerator * lower_denominator - lower_numerator * upper_denominator,
+                                          lower_numerator * upper_denominator,
+                                          0,
+                                          lower_denominator * upper_denominator);
+
+    const Rational width = upper - lower;
+
+    const auto endpoint = [&lower, &width](const boost::multiprecision::cpp_int &numerator, const int depth)
+    {
+      return lower + width * Rational(numerator, boost::multiprecision::cpp_int(1) << depth);
+    };
+
+    std::vector<std::pair<Rational, Rational>> intervals;
+
+    // Explicit stack instead of recursion. Left half is pushed last so that intervals come in ascending order.
+    std::vector<Node> stack = {{IntegerPolynomial::remove_power_of_two_content(unit_polynomial), 0, 0, false}};
+
+    while (!stack.empty())
+    {
+      Node node = std::move(stack.back());
+      stack.pop_back();
+
+      const Rational left = endpoint(node.numerator, node.depth);
+
+      if (node.is_root)
+      {
+        intervals.push_back({left, left});
+        continue;
+      }
+
+      const int variations = count_variations_in_unit_interval(node.polynomial);
+
+      if (variations == 0)
+        continue;
+
+      // Right end must not be a root for half-open interval, so split further when it is
+      if (variations == 1 && value_at_one(node.polynomial) != 0)
+      {
+        intervals.push_back({left, endpoint(node.numerator + 1, node.depth)});
+        continue;
+      }
+
+      const auto left_polynomial = IntegerPolynomial::remove_power_of_two_content(IntegerPolynomial::half_argument(node.polynomial));
+      auto right_polynomial = IntegerPolynomial::taylor_shift(left_polynomial, 1);
+
+      const bool is_middle_root = right_polynomial.a.at(0) == 0;
+
+      if (is_middle_root)
+      {
+        // Divide by x so that the root at the middle is not counted again
+        right_polynomial = UnivariatePolynomial<boost::multiprecision::cpp_int>(std::vector<boost::multiprecision::cpp_int>(right_polynomial.a.begin() + 1, right_polynomial.a.end()));
+      }
+
+      stack.push_back({right_polynomial, 2 * node.numerator + 1, node.depth + 1, false});
+
+      if (is_middle_root)
+        stack.push_back({{}, 2 * node.numerator + 1, node.depth + 1, true});
+
+      stack.push_back({left_polynomial, 2 * node.numerator, node.depth + 1, false});
+    }
+
+    if (IntegerPolynomial::sign_at(p, upper) == 0)
+      intervals.push_back({upper, upper});
+
+    return intervals;
+  }
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for factorization of univariate polynomials into irreducible factors over integers (and rational).
+*
+*  Square-free part is factored by Zassenhaus algorithm:
+*
+*    1. Factor f modulo a small prime p which keeps f square-free, by distinct-degree and Cantor-Zassenhaus equal-degree factorization.
+*    2. Lift the modular factors to modulus p^k above twice the Mignotte bound of factor coefficients times lc(f), by quadratic Hensel lifting.
+*    3. Recombine subsets of the lifted factors and keep the products which divide f over integers.
+*
+*  https://en.wikipedia.org/wiki/Factorization_of_polynomials#Factoring_univariate_polynomials_over_the_integers
+*/
+class Factorization
+{
+public:
+  /*
+  *   Square-free decomposition by Yun's algorithm: f = c * prod a_i^i with monic square-free a_i which are pairwise coprime.
+  *   Return each non-constant a_i with its multiplicity i.
+  */
+  static std::vector<std::pair<UnivariatePolynomial<Rational>, int>> square_free_decomposition(const UnivariatePolynomial<Rational> &f);
+
+  /*
+  *   Irreducible factors of square-free polynomial over integers. Factors are primitive with positive leading coefficient,
+  *   sorted by degree and coefficients. Content of f is not factored. Throw when f is not square-free.
+  */
+  static std::vector<UnivariatePolynomial<boost::multiprecision::cpp_int>> square_free_factors(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f);
+
+  /*
+  *   Distinct rational roots of square-free polynomial over integers in increasing order.
+  *   Roots modulo a small prime are lifted by p-adic Newton's iteration and only the lifts which are roots over rational are kept.
+  *   Throw when f is not square-free.
+  */
+  static std::vector<Rational> rational_roots(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f);
+
+  // Irreducible factors over integers with multiplicities, up to constant factor
+  static std::vector<std::pair<UnivariatePolynomial<boost::multiprecision::cpp_int>, int>> factor(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f);
+
+  // Monic irreducible factors over rational with multiplicities, up to constant factor
+  static std::vector<std::pair<UnivariatePolynomial<Rational>, int>> factor(const UnivariatePolynomial<Rational> &f);
+};
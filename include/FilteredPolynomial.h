@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <FloatingPointHorner.h>
+#include <IntegerPolynomial.h>
+#include <Rational.h>
+#include <ThreadLocalCounter.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for sign evaluation of polynomial with a certified floating-point filter.
+*
+*  It keeps a primitive integer copy of the polynomial and its double image scaled by a power of two.
+*  Horner's rule on the image runs with an error bound: when the approximate value is farther from zero than the bound,
+*  its sign is the exact sign. Otherwise the sign is evaluated exactly on the integer copy.
+*/
+class FilteredPolynomial
+{
+private:
+  UnivariatePolynomial<boost::multiprecision::cpp_int> integer_polynomial;
+
+  // a_i * 2^(-scale) rounded into double
+  std::vector<double> approximate_coefficients;
+  int scale = 0;
+
+  // Absolute error of each approximate coefficient which is not covered by relative error (i.e. underflow)
+  std::vector<double> underflow_errors;
+
+  // Relative error of approximate coefficient
+  static constexpr double coefficient_error = 0x1p-51;
+
+  // Statistics of the filter, counted per thread so that parallel sign evaluations don't share a cache line
+  struct FilterHit;
+  struct FilterMiss;
+
+  typedef ThreadLocalCounter<FilterHit> HitCounter;
+  typedef ThreadLocalCounter<FilterMiss> MissCounter;
+
+  // Sign of number in {-1, 0, +1}
+  static int sign(const double d)
+  {
+    return (d > 0) - (d < 0);
+  }
+
+  // Sign decided by approximate value and its error bound
+  static std::optional<int> certified_sign(const double value, const double error_bound)
+  {
+    // Negated comparison so that NaN is also undecided
+    if (!(std::abs(value) > error_bound))
+      return std::nullopt;
+
+    return sign(value);
+  }
+
+public:
+  FilteredPolynomial() {} // For zero polynomial
+
+  FilteredPolynomial(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+      : integer_polynomial(p), approximate_coefficients(p.a.size()), underflow_errors(p.a.size())
+  {
+    int maximum_bit = 0;
+
+    for (const auto &each_a : p.a)
+    {
+      if (each_a != 0)
+        maximum_bit = std::max(maximum_bit, static_cast<int>(boost::multiprecision::msb(abs(each_a))));
+    }
+
+    // Scale the largest coefficient around 2^512 so that Horner's rule rarely overflows
+    scale = maximum_bit - 512;
+
+    for (size_t a_i = 0; a_i < p.a.size(); a_i++)
+    {
+      auto [mantissa, exponent] = FloatingPointHorner::split(p.a.at(a_i));
+
+      if (exponent - scale < -FloatingPointHorner::exponent_limit)
+      {
+        // |a_i| < 2^(exponent + 53) is dropped
+        approximate_coefficients.at(a_i) = 0;
+        underflow_errors.at(a_i) = std::ldexp(1.0, std::max(exponent - scale + 53, -FloatingPointHorner::exponent_limit));
+      }
+      else
+      {
+        approximate_coefficients.at(a_i) = p.a.at(a_i).sign() * std::ldexp(mantissa, exponent - scale);
+      }
+    }
+  }
+
+  FilteredPolynomial(const UnivariatePolynomial<Rational> &p) : FilteredPolynomial(IntegerPolynomial::primitive_part(p)) {}
+
+  // Primitive integer polynomial evaluated in the exact path
+  const UnivariatePolynomial<boost::multiprecision::cpp_int> &integer() const
+  {
+    return integer_polynomial;
+  }
+
+  // Power of two dividing the integer polynomial into its floating-point image
+  int image_scale() const
+  {
+    return scale;
+  }
+
+  /*
+  *   Approximate value of the image (integer polynomial times 2^(-image_scale())) at each point given with relative error point_error,
+  *   and its error bound which is infinity on overflow. All points are evaluated together (in SIMD lanes if enabled).
+  */
+  void evaluate_image(const std::vector<double> &points, const double point_error, std::vector<double> &values, std::vector<double> &error_bounds) const
+  {
+    values.resize(points.size());
+    error_bounds.resize(points.size());
+
+    FloatingPointHorner::evaluate(approximate_coefficients.data(), underflow_errors.data(), approximate_coefficients.size(), coefficient_error,
+                                  points.data(), point_error, points.size(), values.data(), error_bounds.data());
+  }
+
+  // Sign at r decided only by floating-point evaluation. Return no value when the error bound cannot exclude zero.
+  std::optional<int> approximate_sign_at(const Rational &r) const
+  {
+    const double x = FloatingPointHorner::approximate(r);
+
+    double value, error_bound;
+
+    FloatingPointHorner::evaluate(approximate_coefficients.data(), underflow_errors.data(), approximate_coefficients.size(), coefficient_error,
+                                  &x, FloatingPointHorner::rational_error, 1, &value, &error_bound);
+
+    return certified_sign(value, error_bound);
+  }
+
+  /*
+  *   Sign which is common to all points in [lower, upper], decided by interval Horner's rule on floating-point image.
+  *   Return no value when the range of the polynomial over the interval cannot exclude zero.
+  */
+  std::optional<int> approximate_sign_on(const Rational &lower, const Rational &upper) const
+  {
+    double lower_value, upper_value, error_bound;
+
+    FloatingPointHorner::evaluate_on_interval(approximate_coefficients.data(), underflow_errors.data(), approximate_coefficients.size(), coefficient_error,
+                                              FloatingPointHorner::approximate(lower), FloatingPointHorner::approximate(upper), FloatingPointHorner::rational_error,
+                                              &lower_value, &upper_value, &error_bound);
+
+    // Ends without approximation and overflow give infinite range and bound, which are undecided
+    if (lower_value > error_bound)
+      return 1;
+
+    if (upper_value < -error_bound)
+      return -1;
+
+    return std::nullopt;
+  }
+
+  // Sign at r. Try floating-point filter first and fall back to integer Horner's rule.
+  int sign_at(const Rational &r) const
+  {
+    if (auto approximate_sign = approximate_sign_at(r))
+    {
+      HitCounter::increment();
+      return *approximate_sign;
+    }
+
+    MissCounter::increment();
+    return IntegerPolynomial::sign_at(integer_polynomial, r);
+  }
+
+  /*
+  *   Sign at each of many points given by their floating-point approximations. All points are evaluated together
+  *   on floating-point image (in SIMD lanes if enabled) and each undecided point i is evaluated exactly by exact_sign(i).
+  */
+  template <class ExactSign>
+  std::vector<int> sign_at(const std::vector<double> &approximate_points, ExactSign exact_sign) const
+  {
+    std::vector<double> values, error_bounds;
+
+    evaluate_image(approximate_points, FloatingPointHorner::rational_error, values, error_bounds);
+
+    std::vector<int> signs(approximate_points.size());
+
+    for (size_t i = 0; i < approximate_points.size(); i++)
+    {
+      if (auto approximate_sign = certified_sign(values.at(i), error_bounds.at(i)))
+      {
+        HitCounter::increment();
+        signs.at(i) = *approximate_sign;
+      }
+      else
+      {
+        MissCounter::increment();
+        signs.at(i) = exact_sign(i);
+      }
+    }
+
+    return signs;
+  }
+
+  // Sign at each of many points. Undecided points are evaluated by integer Horner's rule.
+  std::vector<int> sign_at(const std::vector<Rational> &points) const
+  {
+    std::vector<double> approximate_points(points.size());
+
+    std::transform(points.begin(), points.end(), approximate_points.begin(), FloatingPointHorner::approximate);
+
+    return sign_at(approximate_points, [this, &points](const size_t i)
+                   { return IntegerPolynomial::sign_at(integer_polynomial, points.at(i)); });
+  }
+
+  // Number of sign evaluations decided by the filter
+  static unsigned long long filter_hits()
+  {
+    return HitCounter::total();
+  }
+
+  // Number of sign evaluations which fell back to exact arithmetic
+  static unsigned long long filter_misses()
+  {
+    return MissCounter::total();
+  }
+
+  // Ratio of filter hits in all sign evaluations
+  static double filter_hit_rate()
+  {
+    const unsigned long long hits = HitCounter::total(), misses = MissCounter::total();
+
+    if (hits + misses == 0)
+      return 0;
+
+    return static_cast<double>(hits) / (hits + misses);
+  }
+
+  static void reset_filter_counters()
+  {
+    HitCounter::reset();
+    MissCounter::reset();
+  }
+};
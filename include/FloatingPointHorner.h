@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <Rational.h>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/*
+*  Class for Horner's rule on double coefficient image with a certified error bound.
+*
+*  With S = sum |c_i| |x|^i, the computed value differs from the exact value of the polynomial less than
+*
+*    2 * ((2n u + n delta + epsilon) S + E)
+*
+*  where u is unit roundoff, delta is relative error of the point, epsilon is relative error of coefficients
+*  and E is absolute error of coefficients (and underflow) carried by Horner's rule.
+*  The factor 2 covers higher order terms and the rounding in the bound itself.
+*
+*  Many points are evaluated in AVX-512 or AVX2 lanes when the instruction set is enabled at compile time.
+*/
+class FloatingPointHorner
+{
+private:
+  static constexpr double unit_roundoff = 0x1p-53;
+
+  // Absolute error added at each Horner step to cover underflow in the evaluation
+  static constexpr double step_error = 0x1p-1000;
+
+  static double error_factor(const int degree, const double relative_error, const double point_error)
+  {
+    return (2 * degree + 2) * unit_roundoff + (degree + 1) * point_error + relative_error;
+  }
+
+public:
+  // Limit of exponent to treat floating-point number as normal
+  static constexpr int exponent_limit = 960;
+
+  // Relative error of approximate rational number
+  static constexpr double rational_error = 0x1p-50;
+
+  /*
+  *   Split |k| into mantissa m < 2^53 and exponent e such that m * 2^e approximates |k|
+  *   with relative error less than 2^-52. The mantissa is exact integer in double.
+  */
+  static std::pair<double, int> split(const boost::multiprecision::cpp_int &k)
+  {
+    const boost::multiprecision::cpp_int absolute_k = abs(k);
+
+    if (absolute_k == 0)
+      return {0, 0};
+
+    const int most_significant_bit = boost::multiprecision::msb(absolute_k);
+
+    if (most_significant_bit < 53)
+      return {absolute_k.convert_to<double>(), 0};
+
+    const int shift = most_significant_bit - 52;
+
+    return {boost::multiprecision::cpp_int(absolute_k >> shift).convert_to<double>(), shift};
+  }
+
+  /*
+  *   Rational number into double with relative error less than rational_error.
+  *   Return NaN when the number is too large or too small to keep the relative error.
+  */
+  static double approximate(const Rational &r)
+  {
+    auto [numerator_mantissa, numerator_exponent] = split(r.get_numerator());
+    auto [denominator_mantissa, denominator_exponent] = split(r.get_denominator());
+
+    if (std::abs(numerator_exponent - denominator_exponent) > exponent_limit)
+      return std::nan("");
+
+    return r.sign() * std::ldexp(numerator_mantissa / denominator_mantissa, numerator_exponent - denominator_exponent);
+  }
+
+  /*
+  *   Evaluate c_0 + c_1 x + ... + c_(size - 1) x^(size - 1) at count points.
+  *   Write approximate value and its error bound for each point. The bound is infinity when the evaluation overflows.
+  *
+  *   absolute_errors: absolute error of each coefficient
+  *   relative_error: relative error of all coefficients
+  *   point_error: relative error of all points
+  */
+  static void evaluate(const double *coefficients, const double *absolute_errors, const size_t size, const double relative_error,
+                       const double *points, const double point_error, const size_t count,
+                       double *values, double *error_bounds)
+  {
+    if (size == 0)
+    {
+      for (size_t i = 0; i < count; i++)
+      {
+        values[i] = 0;
+        error_bounds[i] = 0;
+      }
+      return;
+    }
+
+    const int degree = size - 1;
+    const double factor = error_factor(degree, relative_error, point_error);
+
+    size_t i = 0;
+
+#if defined(__AVX512F__)
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m512d x = _mm512_loadu_pd(points + i);
+      const __m512d absolute_x = _mm512_abs_pd(x);
+
+      __m512d value = _mm512_set1_pd(coefficients[degree]);
+      __m512d absolute_value = _mm512_set1_pd(std::abs(coefficients[degree]));
+      __m512d absolute_error = _mm512_set1_pd(absolute_errors[degree]);
+
+      for (int c_i = degree - 1; c_i >= 0; c_i--)
+      {
+        value = _mm512_add_pd(_mm512_mul_pd(value, x), _mm512_set1_pd(coefficients[c_i]));
+        absolute_value = _mm512_add_pd(_mm512_mul_pd(absolute_value, absolute_x), _mm512_set1_pd(std::abs(coefficients[c_i])));
+        absolute_error = _mm512_add_pd(_mm512_mul_pd(absolute_error, absolute_x), _mm512_set1_pd(absolute_errors[c_i] + step_error));
+      }
+
+      const __m512d bound = _mm512_mul_pd(_mm512_set1_pd(2), _mm512_add_pd(_mm512_mul_pd(absolute_value, _mm512_set1_pd(factor)), absolute_error));
+
+      _mm512_storeu_pd(values + i, value);
+      _mm512_storeu_pd(error_bounds + i, bound);
+    }
+#elif defined(__AVX2__)
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+    for (; i + 4 <= count; i += 4)
+    {
+      const __m256d x = _mm256_loadu_pd(points + i);
+      const __m256d absolute_x = _mm256_andnot_pd(sign_mask, x);
+
+      __m256d value = _mm256_set1_pd(coefficients[degree]);
+      __m256d absolute_value = _mm256_set1_pd(std::abs(coefficients[degree]));
+      __m256d absolute_error = _mm256_set1_pd(absolute_errors[degree]);
+
+      for (int c_i = degree - 1; c_i >= 0; c_i--)
+      {
+        value = _mm256_add_pd(_mm256_mul_pd(value, x), _mm256_set1_pd(coefficients[c_i]));
+        absolute_value = _mm256_add_pd(_mm256_mul_pd(absolute_value, absolute_x), _mm256_set1_pd(std::abs(coefficients[c_i])));
+        absolute_error = _mm256_add_pd(_mm256_mul_pd(absolute_error, absolute_x), _mm256_set1_pd(absolute_errors[c_i] + step_error));
+      }
+
+      const __m256d bound = _mm256_mul_pd(_mm256_set1_pd(2), _mm256_add_pd(_mm256_mul_pd(absolute_value, _mm256_set1_pd(factor)), absolute_error));
+
+      _mm256_storeu_pd(values + i, value);
+      _mm256_storeu_pd(error_bounds + i, bound);
+    }
+#endif
+
+    // Scalar fallback for the rest of points (or all points without SIMD)
+    for (; i < count; i++)
+    {
+      const double x = points[i];
+      const double absolute_x = std::abs(x);
+
+      double value = coefficients[degree];
+      double absolute_value = std::abs(coefficients[degree]);
+      double absolute_error = absolute_errors[degree];
+
+      for (int c_i = degree - 1; c_i >= 0; c_i--)
+      {
+        value = value * x + coefficients[c_i];
+        absolute_value = absolute_value * absolute_x + std::abs(coefficients[c_i]);
+        absolute_error = absolute_error * absolute_x + (absolute_errors[c_i] + step_error);
+      }
+
+      values[i] = value;
+      error_bounds[i] = 2 * (absolute_value * factor + absolute_error);
+    }
+
+    for (size_t j = 0; j < count; j++)
+    {
+      if (!std::isfinite(values[j]) || !std::isfinite(error_bounds[j]))
+        error_bounds[j] = HUGE_VAL;
+    }
+  }
+
+  /*
+  *   Enclose the range of the polynomial over [lower, upper] by interval Horner's rule.
+  *   Each end of the range is a Horner's rule along some choice of lower or upper at each step,
+  *   so the error bound of the single point evaluation at max(|lower|, |upper|) also covers both ends.
+  *   Write the approximate range and the error bound. The range is (-inf, inf) and the bound is infinity
+  *   when an end is not finite (e.g. NaN approximation of a huge rational) or the evaluation overflows.
+  */
+  static void evaluate_on_interval(const double *coefficients, const double *absolute_errors, const size_t size, const double relative_error,
+                                   const double lower, const double upper, const double point_error,
+                                   double *lower_value, double *upper_value, double *error_bound)
+  {
+    if (size == 0)
+    {
+      *lower_value = *upper_value = *error_bound = 0;
+      return;
+    }
+
+    const auto undecided = [lower_value, upper_value, error_bound]
+    {
+      *lower_value = -HUGE_VAL;
+      *upper_value = *error_bound = HUGE_VAL;
+    };
+
+    // std::min_element, std::max_element and std::max silently skip NaN, which would leave the range of one end only
+    if (!std::isfinite(lower) || !std::isfinite(upper))
+      return undecided();
+
+    const int degree = size - 1;
+    const double absolute_x = std::max(std::abs(lower), std::abs(upper));
+
+    double value_lower = coefficients[degree], value_upper = coefficients[degree];
+    double absolute_value = std::abs(coefficients[degree]);
+    double absolute_error = absolute_errors[degree];
+
+    for (int c_i = degree - 1; c_i >= 0; c_i--)
+    {
+      const double products[] = {value_lower * lower, value_lower * upper, value_upper * lower, value_upper * upper};
+
+      if (!std::all_of(products, products + 4, [](const double product)
+                       { return std::isfinite(product); }))
+        return undecided();
+
+      value_lower = *std::min_element(products, products + 4) + coefficients[c_i];
+      value_upper = *std::max_element(products, products + 4) + coefficients[c_i];
+      absolute_value = absolute_value * absolute_x + std::abs(coefficients[c_i]);
+      absolute_error = absolute_error * absolute_x + (absolute_errors[c_i] + step_error);
+    }
+
+    *lower_value = value_lower;
+    *upper_value = value_upper;
+    *error_bound = 2 * (absolute_value * error_factor(degree, relative_error, point_error) + absolute_error);
+
+    if (!std::isfinite(value_lower) || !std::isfinite(value_upper) || !std::isfinite(*error_bound))
+      undecided();
+  }
+};
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for univariate polynomial operations specialized to integer coefficients.
+*
+*  A polynomial over rational is mapped into a primitive integer polynomial c * p with positive c.
+*  It has the same roots and the same sign at every point, so sign evaluation needs neither division nor GCD.
+*/
+class IntegerPolynomial
+{
+public:
+  /*
+  *   Primitive integer polynomial which is a positive multiple of p.
+  *   Multiply all coefficients by LCM of the denominators and then divide them by GCD of the numerators.
+  */
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> primitive_part(const UnivariatePolynomial<Rational> &p)
+  {
+    boost::multiprecision::cpp_int denominator_lcm = 1;
+
+    for (const auto &each_a : p.a)
+    {
+      denominator_lcm = lcm(denominator_lcm, abs(each_a.get_denominator()));
+    }
+
+    std::vector<boost::multiprecision::cpp_int> integer_a(p.a.size());
+
+    boost::multiprecision::cpp_int content = 0;
+
+    for (size_t a_i = 0; a_i < p.a.size(); a_i++)
+    {
+      // Denominator of Rational can be negative, so divide it with sign
+      integer_a.at(a_i) = p.a.at(a_i).get_numerator() * (denominator_lcm / p.a.at(a_i).get_denominator());
+      content = gcd(content, integer_a.at(a_i));
+    }
+
+    if (content > 1)
+    {
+      for (auto &each_a : integer_a)
+      {
+        each_a /= content;
+      }
+    }
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(integer_a);
+  }
+
+  /*
+  *   Homogenized value q^n f(p/q) where n = degree f, computed by Horner's rule without division:
+  *
+  *     (...((a_n p + a_(n-1) q) p + a_(n-2) q^2) p + ...) + a_0 q^n
+  */
+  static boost::multiprecision::cpp_int homogenized_value_at(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f,
+                                                             const boost::multiprecision::cpp_int &numerator,
+                                                             const boost::multiprecision::cpp_int &denominator)
+  {
+    if (f.a.size() == 0)
+      return 0;
+
+    boost::multiprecision::cpp_int accumulator = f.a.back();
+    boost::multiprecision::cpp_int denominator_power = 1;
+
+    for (int a_i = f.degree() - 1; a_i >= 0; a_i--)
+    {
+      denominator_power *= denominator;
+      accumulator *= numerator;
+      accumulator += f.a.at(a_i) * denominator_power;
+    }
+
+    return accumulator;
+  }
+
+  // Number of sign variations in the coefficient sequence, ignoring zeros
+  static int sign_variations(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+  {
+    int count = 0, last_sign = 0;
+
+    for (const auto &each_a : f.a)
+    {
+      const int each_sign = each_a.sign();
+
+      if (each_sign == 0)
+        continue;
+
+      if (last_sign * each_sign < 0)
+        count++;
+
+      last_sign = each_sign;
+    }
+
+    return count;
+  }
+
+  // x^n f(1/x): coefficients in reverse order
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> reverse(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+  {
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(std::vector<boost::multiprecision::cpp_int>(f.a.rbegin(), f.a.rend()));
+  }
+
+  // f(x + c) by Taylor shift with O(n^2) multiply-adds (only additions for c = 1)
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> taylor_shift(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const boost::multiprecision::cpp_int &c)
+  {
+    auto shifted_a = f.a;
+
+    for (int i = 0; i < f.degree(); i++)
+    {
+      for (int j = f.degree() - 1; j >= i; j--)
+      {
+        if (c == 1)
+        {
+          shifted_a.at(j) += shifted_a.at(j + 1);
+        }
+        else
+        {
+          shifted_a.at(j) += c * shifted_a.at(j + 1);
+        }
+      }
+    }
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(shifted_a);
+  }
+
+  // 2^n f(x / 2)
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> half_argument(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+  {
+    auto scaled_a = f.a;
+
+    for (int i = 0; i <= f.degree(); i++)
+    {
+      scaled_a.at(i) <<= f.degree() - i;
+    }
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(scaled_a);
+  }
+
+  // Divide all coefficients by the largest power of two dividing them
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> remove_power_of_two_content(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+  {
+    unsigned shift = UINT_MAX;
+
+    for (const auto &each_a : f.a)
+    {
+      if (each_a != 0)
+        shift = std::min(shift, boost::multiprecision::lsb(abs(each_a)));
+    }
+
+    if (shift == 0 || shift == UINT_MAX)
+      return f;
+
+    auto reduced_a = f.a;
+
+    for (auto &each_a : reduced_a)
+    {
+      each_a /= boost::multiprecision::cpp_int(1) << shift;
+    }
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(reduced_a);
+  }
+
+  // Quotient f / g over integers for non-zero g, or no value when g doesn't divide f
+  static std::optional<UnivariatePolynomial<boost::multiprecision::cpp_int>> exact_quotient(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f,
+                                                                                     const UnivariatePolynomial<boost::multiprecision::cpp_int> &g)
+  {
+    if (f == 0)
+      return f;
+
+    if (f.degree() < g.degree())
+      return std::nullopt;
+
+    std::vector<boost::multiprecision::cpp_int> remainder = f.a, quotient(f.degree() - g.degree() + 1);
+
+    for (int i = f.degree() - g.degree(); i >= 0; i--)
+    {
+      const boost::multiprecision::cpp_int &dividend = remainder.at(i + g.degree());
+
+      if (dividend % g.leading_coefficient() != 0)
+        return std::nullopt;
+
+      quotient.at(i) = dividend / g.leading_coefficient();
+
+      for (int j = 0; j <= g.degree(); j++)
+      {
+        remainder.at(i + j) -= quotient.at(i) * g.a.at(j);
+      }
+    }
+
+    if (std::any_of(remainder.begin(), remainder.end(), [](const boost::multiprecision::cpp_int &r)
+                    { return r != 0; }))
+      return std::nullopt;
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(quotient);
+  }
+
+  /*
+  *   Composition with Mobius transformation: (cx + d)^n f((ax + b) / (cx + d)) where n = degree f.
+  *   Computed by homogeneous Horner's rule:
+  *
+  *     (...(a_n (ax + b) + a_(n-1) (cx + d)) (ax + b) + a_(n-2) (cx + d)^2 ...) + a_0 (cx + d)^n
+  */
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> compose_mobius(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f,
+                                                                             const boost::multiprecision::cpp_int &a, const boost::multiprecision::cpp_int &b,
+                                                                             const boost::multiprecision::cpp_int &c, const boost::multiprecision::cpp_int &d)
+  {
+    if (f.degree() <= 0)
+      return f;
+
+    const UnivariatePolynomial<boost::multiprecision::cpp_int> numerator({b, a}), denominator({d, c});
+
+    UnivariatePolynomial<boost::multiprecision::cpp_int> accumulator(f.leading_coefficient()), denominator_power(1);
+
+    for (int i = f.degree() - 1; i >= 0; i--)
+    {
+      denominator_power *= denominator;
+      accumulator *= numerator;
+      accumulator += f.a.at(i) * denominator_power;
+    }
+
+    return accumulator;
+  }
+
+  // Value f(r) as rational number, computed by homogenized Horner's rule and one division at the end
+  static Rational value_at(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const Rational &r)
+  {
+    boost::multiprecision::cpp_int numerator = r.get_numerator(), denominator = r.get_denominator();
+
+    if (denominator < 0)
+    {
+      numerator = -numerator;
+      denominator = -denominator;
+    }
+
+    return Rational(homogenized_value_at(f, numerator, denominator), boost::multiprecision::pow(denominator, std::max(f.degree(), 0)));
+  }
+
+  // Sign of f(r). The denominator of r is made positive so that q^n does not flip the sign.
+  static int sign_at(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const Rational &r)
+  {
+    boost::multiprecision::cpp_int numerator = r.get_numerator(), denominator = r.get_denominator();
+
+    if (denominator < 0)
+    {
+      numerator = -numerator;
+      denominator = -denominator;
+    }
+
+    return homogenized_value_at(f, numerator, denominator).sign();
+  }
+
+  /*
+  *   Tables of p^i and q^i (0 <= i <= n) for r = p / q with positive q.
+  *   They are shared among polynomials of degree at most n which are evaluated at the same point.
+  */
+  static std::pair<std::vector<boost::multiprecision::cpp_int>, std::vector<boost::multiprecision::cpp_int>> power_tables(const Rational &r, const int n)
+  {
+    const int sign = r.get_denominator() < 0 ? -1 : 1;
+
+    std::vector<boost::multiprecision::cpp_int> numerator_powers(std::max(n, 0) + 1), denominator_powers(std::max(n, 0) + 1);
+
+    numerator_powers.at(0) = 1;
+    denominator_powers.at(0) = 1;
+
+    for (int i = 1; i <= n; i++)
+    {
+      numerator_powers.at(i) = numerator_powers.at(i - 1) * r.get_numerator() * sign;
+      denominator_powers.at(i) = denominator_powers.at(i - 1) * r.get_denominator() * sign;
+    }
+
+    return {numerator_powers, denominator_powers};
+  }
+
+  // Sign of q^m f(p / q) where m = degree f, with tables from power_tables for n >= m
+  static int sign_at(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f,
+                     const std::vector<boost::multiprecision::cpp_int> &numerator_powers,
+                     const std::vector<boost::multiprecision::cpp_int> &denominator_powers)
+  {
+    boost::multiprecision::cpp_int value = 0;
+
+    for (int i = 0; i <= f.degree(); i++)
+    {
+      if (f.a.at(i) != 0)
+        value += f.a.at(i) * numerator_powers.at(i) * denominator_powers.at(f.degree() - i);
+    }
+
+    return value.sign();
+  }
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+// Algorithm to isolate real roots of polynomial
+enum class IsolationStrategy
+{
+  Sturm,              // Bisection counting sign changes of Sturm sequence
+  Descartes,          // Bisection by Descartes' rule of signs on integer polynomial (Vincent-Collins-Akritas)
+  ContinuedFraction,  // Continued fraction steps by lower bounds of positive roots (Vincent-Akritas-Strzebonski)
+  BitstreamDescartes, // Descartes bisection on truncated coefficients, for polynomial with huge coefficients
+  Aberth              // Separators from Aberth-Ehrlich approximation certified by Sturm sequence, with bisection where it fails
+};
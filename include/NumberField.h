@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/operators.hpp>
+
+#include <AlgebraicReal.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+class FieldElement;
+
+/*
+  Class for real number field Q(alpha) generated by an algebraic real alpha:
+
+  Elements are polynomials in alpha of degree less than n = degree of the minimal polynomial m of alpha,
+  so arithmetic is polynomial arithmetic modulo m and no resultant is computed until an element is converted into AlgebraicReal.
+  Copies share the field, and elements of one field can be mixed only with elements of the same field.
+*/
+class NumberField
+{
+private:
+  struct Generator
+  {
+    // Monic irreducible polynomial over rational which has alpha as a root
+    UnivariatePolynomial<Rational> minimal_polynomial;
+    // alpha defined by the minimal polynomial
+    AlgebraicReal alpha;
+  };
+
+  std::shared_ptr<const Generator> generator;
+
+public:
+  // Field generated by alpha. Its minimal polynomial is the irreducible factor of the defining polynomial vanishing at alpha.
+  explicit NumberField(const AlgebraicReal &alpha);
+
+  const UnivariatePolynomial<Rational> &minimal_polynomial() const;
+  const AlgebraicReal &primitive_element() const;
+  // Degree [Q(alpha) : Q]
+  int degree() const;
+
+  // alpha as an element of the field
+  FieldElement alpha() const;
+  // p(alpha) as an element of the field
+  FieldElement element(const UnivariatePolynomial<Rational> &p) const;
+
+  // Same field when the generators are shared or equal
+  friend bool operator==(const NumberField &f1, const NumberField &f2);
+  friend bool operator!=(const NumberField &f1, const NumberField &f2);
+};
+
+/*
+  Class for element of NumberField, represented by the unique polynomial r of degree less than n with value r(alpha).
+*/
+class FieldElement : private boost::field_operators<FieldElement>, private boost::equality_comparable<FieldElement>
+{
+private:
+  NumberField number_field;
+  UnivariatePolynomial<Rational> representative;
+
+  // Throw when the element belongs to another field
+  void check_same_field(const FieldElement &e) const;
+
+public:
+  // p(alpha) in the field
+  FieldElement(const NumberField &number_field, const UnivariatePolynomial<Rational> &p);
+  // Integer in the field
+  FieldElement(const NumberField &number_field, const int n);
+  // Rational number in the field
+  FieldElement(const NumberField &number_field, const Rational &r);
+
+  const NumberField &field() const;
+  // Polynomial r of degree less than n with value r(alpha)
+  const UnivariatePolynomial<Rational> &polynomial() const;
+
+  FieldElement operator+() const;
+  FieldElement operator-() const;
+
+  FieldElement &operator+=(const FieldElement &e);
+  FieldElement &operator-=(const FieldElement &e);
+  FieldElement &operator*=(const FieldElement &e);
+  FieldElement &operator/=(const FieldElement &e);
+
+  friend bool operator==(const FieldElement &e1, const FieldElement &e2);
+
+  friend std::ostream &operator<<(std::ostream &os, const FieldElement &e);
+
+  bool is_rational() const;
+  // Inverse by extended Euclidean algorithm: s r + t m = 1 gives 1 / r(alpha) = s(alpha)
+  FieldElement inverse() const;
+  // Power by repeated squaring modulo the minimal polynomial
+  FieldElement pow(const boost::multiprecision::cpp_int index) const;
+  // Sign by interval evaluation of r on refined intervals of alpha, without computing a resultant
+  int sign() const;
+
+  /*
+  *   Convert into AlgebraicReal: the defining polynomial is the square-free part of Res_y(m(y), x - r(y)),
+  *   and the interval is r evaluated on intervals of alpha refined until it isolates one root.
+  */
+  AlgebraicReal to_algebraic_real() const;
+};
@@ -1,5 +1,11 @@
+#pragma once
+
+#include <vector>
+
 #include <boost/multiprecision/cpp_int.hpp>
 
+#include <Budget.h>
+#include <IntegerUtils.h>
 #include <UnivariatePolynomial.h>
 
 class PolynomialRemainderSequence
@@ -55,6 +61,8 @@ private:
     if (g == 0)
       return {};
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -90,6 +98,8 @@ private:
     if (g == 0)
       return {};
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -127,6 +137,8 @@ public:
     if (g == 0)
       return {};
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -147,6 +159,8 @@ public:
     if (g == 0)
       return {};
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -167,6 +181,8 @@ public:
     if (g == 0)
       return {};
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     auto tail = do_reduced_polynomial_remainder_sequence(f.degree(), g, remainder);
@@ -186,6 +202,8 @@ public:
 
     int delta = f.degree() - g.degree();
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     auto s = IntegerUtils::minus_one_power(delta + 1) * remainder;
@@ -196,4 +214,67 @@ public:
 
     return tail;
   }
+
+  /*
+  *   Sturm sequence f, g, T_2, T_3, ... over integers by signed subresultants (Sturm-Habicht style).
+  *   Each T_(i + 1) is a positive multiple of -(T_(i - 1) % T_i), so it has the same signs as the Sturm sequence over rational:
+  *
+  *     T_(i + 1) = -sign(lc(T_i))^(delta_i + 1) prem(T_(i - 1), T_i) / |beta_i|
+  *
+  *   where |beta_i| is the absolute value of the divisor in subresultant PRS. Division is exact and coefficient growth is polynomial.
+  */
+  static std::vector<UnivariatePolynomial<boost::multiprecision::cpp_int>>
+  signed_subresultant_polynomial_remainder_sequence(
+      const UnivariatePolynomial<boost::multiprecision::cpp_int> &f,
+      const UnivariatePolynomial<boost::multiprecision::cpp_int> &g)
+  {
+    std::vector<UnivariatePolynomial<boost::multiprecision::cpp_int>> sequence = {f};
+
+    if (g == 0)
+      return sequence;
+
+    sequence.reserve(g.degree() + 2);
+    sequence.push_back(g);
+
+    // |psi_i| and delta_(i - 1)
+    boost::multiprecision::cpp_int psi = 1;
+    int previous_delta = 0;
+
+    while (true)
+    {
+      const auto &previous = sequence.at(sequence.size() - 2);
+      const auto &current = sequence.back();
+
+      const int delta = previous.degree() - current.degree();
+      const boost::multiprecision::cpp_int previous_leading_coefficient = abs(previous.leading_coefficient());
+
+      boost::multiprecision::cpp_int beta = 1;
+
+      if (sequence.size() > 2)
+      {
+        psi = IntegerUtils::pow(previous_leading_coefficient, previous_delta) / IntegerUtils::pow(psi, previous_delta - 1);
+        beta = previous_leading_coefficient * IntegerUtils::pow(psi, delta);
+      }
+
+      Budget::charge();
+
+      auto remainder = previous.pseudo_mod(current);
+
+      if (remainder == 0)
+        break;
+
+      const int sign = (delta + 1) % 2 == 0 ? 1 : current.leading_coefficient().sign();
+
+      for (auto &each_a : remainder.a)
+      {
+        each_a /= beta;
+        each_a *= -sign;
+      }
+
+      sequence.push_back(std::move(remainder));
+      previous_delta = delta;
+    }
+
+    return sequence;
+  }
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -153,3 +154,24 @@ public:
     return accumulator;
   }
 };
+
+/*
+*  Hash consistent with equality.
+*  Reduced fraction is unique up to the signs of numerator and denominator, so the denominator is made positive.
+*/
+namespace std
+{
+  template <>
+  struct hash<Rational>
+  {
+    size_t operator()(const Rational &r) const
+    {
+      const int sign = r.get_denominator() < 0 ? -1 : 1;
+
+      const size_t numerator_hash = hash<boost::multiprecision::cpp_int>()(boost::multiprecision::cpp_int(r.get_numerator() * sign));
+      const size_t denominator_hash = hash<boost::multiprecision::cpp_int>()(boost::multiprecision::cpp_int(r.get_denominator() * sign));
+
+      return numerator_hash ^ (denominator_hash + 0x9e3779b97f4a7c15 + (numerator_hash << 6) + (numerator_hash >> 2));
+    }
+  };
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <IntegerPolynomial.h>
+#include <Rational.h>
+#include <UnivariatePolynomial.h>
+
+/*
+*  Class for bounds of real roots rounded up to power of two, so that they combine with dyadic bisection.
+*
+*  Bounds are computed from bit lengths of integer coefficients: ceil(log2 |a / b|) is found by one shift and comparison.
+*
+*    Fujiwara bound: |z| <= 2 max(|a_(n-1) / a_n|, |a_(n-2) / a_n|^(1/2), ..., |a_0 / (2 a_n)|^(1/n))
+*    Local-max (LMQ) bound for positive roots:
+*      max over negative a_i of min over positive a_j (j > i) of (2^(t_j) |a_i| / a_j)^(1/(j - i))
+*      where t_j starts from 1 and is incremented whenever a_j is used.
+*
+*  https://en.wikipedia.org/wiki/Geometrical_properties_of_polynomial_roots#Bounds_of_positive_real_roots
+*/
+class RootBound
+{
+private:
+  static int bit_length(const boost::multiprecision::cpp_int &k)
+  {
+    return boost::multiprecision::msb(abs(k)) + 1;
+  }
+
+  /*
+  *   ceil(log2 |numerator / denominator|) for non-zero integers.
+  *   With l = bit_length(numerator) - bit_length(denominator), the ratio is in (2^(l - 1), 2^(l + 1)).
+  */
+  static int ceil_log2_ratio(const boost::multiprecision::cpp_int &numerator, const boost::multiprecision::cpp_int &denominator)
+  {
+    const int logarithm = bit_length(numerator) - bit_length(denominator);
+
+    const bool is_under = logarithm >= 0 ? abs(numerator) <= (abs(denominator) << logarithm)
+                                         : (abs(numerator) << -logarithm) <= abs(denominator);
+
+    return is_under ? logarithm : logarithm + 1;
+  }
+
+  // Round up division of integer (divisor > 0)
+  static int ceil_divide(const int dividend, const int divisor)
+  {
+    return dividend >= 0 ? (dividend + divisor - 1) / divisor : -(-dividend / divisor);
+  }
+
+  static UnivariatePolynomial<boost::multiprecision::cpp_int> reflect(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    auto reflected_a = p.a;
+
+    for (size_t a_i = 1; a_i < reflected_a.size(); a_i += 2)
+    {
+      reflected_a.at(a_i) *= -1;
+    }
+
+    return UnivariatePolynomial<boost::multiprecision::cpp_int>(reflected_a);
+  }
+
+  /*
+  *   Exponent of the positive root bound which is used when the polynomial has no positive root.
+  *   Bound must be positive for half-open interval (lower, upper] to contain the root at zero.
+  */
+  static constexpr int no_root_exponent = 0;
+
+public:
+  /*
+  *   Exponent e of Fujiwara bound such that all complex roots z satisfy |z| <= 2^e.
+  *   Return no value when all roots are zero.
+  */
+  static std::optional<int> fujiwara_exponent(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    if (p == 0)
+      throw std::domain_error("Zero polynomial doesn't have root bound");
+
+    const int n = p.degree();
+
+    std::optional<int> exponent;
+
+    for (int i = 1; i <= n; i++)
+    {
+      if (p.a.at(n - i) == 0)
+        continue;
+
+      // The last term is |a_0 / (2 a_n)|
+      const int logarithm_bound = ceil_log2_ratio(p.a.at(n - i), p.leading_coefficient() * (i == n ? 2 : 1));
+
+      exponent = std::max(exponent.value_or(ceil_divide(logarithm_bound, i)), ceil_divide(logarithm_bound, i));
+    }
+
+    if (!exponent)
+      return std::nullopt;
+
+    return *exponent + 1;
+  }
+
+  /*
+  *   Exponent e of local-max bound such that all positive roots are at most 2^e.
+  *   Return no value when there is no positive root (no sign variation in coefficients).
+  */
+  static std::optional<int> local_max_exponent(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    if (p == 0)
+      throw std::domain_error("Zero polynomial doesn't have root bound");
+
+    // Sign of each coefficient is compared with the one of leading coefficient
+    const int leading_sign = p.leading_coefficient().sign();
+    const int n = p.degree();
+
+    std::vector<int> timestamps(n + 1, 1);
+
+    std::optional<int> exponent;
+
+    for (int i = n - 1; i >= 0; i--)
+    {
+      if (p.a.at(i).sign() * leading_sign >= 0)
+        continue;
+
+      std::optional<int> local_exponent;
+
+      for (int j = n; j > i; j--)
+      {
+        if (p.a.at(j).sign() * leading_sign <= 0)
+          continue;
+
+        const int candidate = ceil_divide(timestamps.at(j) + ceil_log2_ratio(p.a.at(i), p.a.at(j)), j - i);
+        timestamps.at(j)++;
+
+        local_exponent = std::min(local_exponent.value_or(candidate), candidate);
+      }
+
+      exponent = std::max(exponent.value_or(*local_exponent), *local_exponent);
+    }
+
+    return exponent;
+  }
+
+  // 2^e
+  static Rational power_of_two(const int exponent)
+  {
+    if (exponent >= 0)
+      return Rational(boost::multiprecision::cpp_int(1) << exponent, 1);
+
+    return Rational(1, boost::multiprecision::cpp_int(1) << -exponent);
+  }
+
+  // Exponent e such that all positive roots are at most 2^e
+  static int positive_root_bound_exponent(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    const auto fujiwara = fujiwara_exponent(p);
+    const auto local_max = local_max_exponent(p);
+
+    if (!local_max)
+      return std::min(fujiwara.value_or(no_root_exponent), no_root_exponent);
+
+    return std::min(fujiwara.value_or(*local_max), *local_max);
+  }
+
+  /*
+  *   Exponent e such that all negative roots are greater than -2^e.
+  *   It is strict because the lower end of half-open interval (lower, upper] is open.
+  */
+  static int negative_root_bound_exponent(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+  {
+    const int exponent = positive_root_bound_exponent(reflect(p));
+
+    if (IntegerPolynomial::sign_at(p, -power_of_two(exponent)) == 0)
+      return exponent + 1;
+
+    return exponent;
+  }
+
+  // All positive roots of p are at most this bound
+  static Rational positive_root_bound(const UnivariatePolynomial<Rational> &p)
+  {
+    return power_of_two(positive_root_bound_exponent(IntegerPolynomial::primitive_part(p)));
+  }
+
+  // All negative roots of p are greater than minus this bound
+  static Rational negative_root_bound(const UnivariatePolynomial<Rational> &p)
+  {
+    return power_of_two(negative_root_bound_exponent(IntegerPolynomial::primitive_part(p)));
+  }
+};
@@ -1,8 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <iostream>
 
+#include <Budget.h>
+#include <FilteredPolynomial.h>
+#include <FloatingPointHorner.h>
+#include <IntegerUtils.h>
+#include <IntegerPolynomial.h>
+#include <PolynomialRemainderSequence.h>
+#include <ThreadLocalCounter.h>
 #include <UnivariatePolynomial.h>
 
 /*
@@ -18,38 +30,203 @@ class SturmSequence
 private:
   std::vector<UnivariatePolynomial<K>> sequence_terms;
 
+  /*
+  *  Primitive integer copy of each term with its floating-point image.
+  *  Sign at rational point is decided by the floating-point filter or by pure integer multiply-adds.
+  */
+  std::vector<FilteredPolynomial> filtered_sequence_terms;
+
+  static std::vector<FilteredPolynomial> map_into_filtered(const std::vector<UnivariatePolynomial<K>> &terms)
+  {
+    std::vector<FilteredPolynomial> filtered_terms(terms.size());
+
+    std::transform(terms.begin(), terms.end(), filtered_terms.begin(), [](const UnivariatePolynomial<K> &p)
+                   { return FilteredPolynomial(p); });
+
+    return filtered_terms;
+  }
+
+  /*
+  *  Signs of each term at positive and negative infinity, which are decided by leading coefficients and degrees.
+  *  They are fixed by the terms, so they are computed once at construction.
+  */
+  std::vector<int> signs_at_positive_infinity;
+  std::vector<int> signs_at_negative_infinity;
+
+  // The cache is cleared when it reaches this size
+  static constexpr size_t sign_change_cache_capacity = 4096;
+
+  /*
+  *  Sign changes at endpoints which are already evaluated, allocated at the first memoized evaluation.
+  *  Copies of a sequence which may have several roots share it, allocating it if needed, so roots of the same polynomial
+  *  reuse the endpoints of each other. Other copies, like the one in every rational AlgebraicReal, share it only once it exists.
+  */
+  class SignChangeCache
+  {
+  private:
+    struct Entries
+    {
+      std::mutex mutex;
+      std::unordered_map<K, int> sign_changes;
+    };
+
+    mutable std::shared_ptr<Entries> entries;
+
+    // Threads may allocate at once from the same const sequence, so the pointer is accessed atomically
+    std::shared_ptr<Entries> shared_entries() const
+    {
+      std::shared_ptr<Entries> current = std::atomic_load(&entries);
+
+      if (!current)
+      {
+        const auto created = std::make_shared<Entries>();
+
+        if (std::atomic_compare_exchange_strong(&entries, &current, created))
+          current = created;
+      }
+
+      return current;
+    }
+
+  public:
+    bool is_shared_with_copies = false;
+
+    SignChangeCache() = default;
+
+    SignChangeCache(const SignChangeCache &other)
+        : entries(other.is_shared_with_copies ? other.shared_entries() : std::atomic_load(&other.entries)),
+          is_shared_with_copies(other.is_shared_with_copies){};
+
+    SignChangeCache(SignChangeCache &&) = default;
+
+    SignChangeCache &operator=(const SignChangeCache &other)
+    {
+      std::atomic_store(&entries, other.is_shared_with_copies ? other.shared_entries() : std::atomic_load(&other.entries));
+      is_shared_with_copies = other.is_shared_with_copies;
+
+      return *this;
+    }
+
+    SignChangeCache &operator=(SignChangeCache &&) = default;
+
+    bool find(const K &r, int &sign_change) const
+    {
+      const std::shared_ptr<Entries> current = std::atomic_load(&entries);
+
+      if (!current)
+        return false;
+
+      std::lock_guard<std::mutex> lock(current->mutex);
+
+      const auto found = current->sign_changes.find(r);
+
+      if (found == current->sign_changes.end())
+        return false;
+
+      sign_change = found->second;
+
+      return true;
+    }
+
+    void insert(const K &r, const int sign_change) const
+    {
+      const std::shared_ptr<Entries> current = shared_entries();
+
+      std::lock_guard<std::mutex> lock(current->mutex);
+
+      if (current->sign_changes.size() >= sign_change_cache_capacity)
+        current->sign_changes.clear();
+
+      current->sign_changes.emplace(r, sign_change);
+    }
+
+    size_t size() const
+    {
+      const std::shared_ptr<Entries> current = std::atomic_load(&entries);
+
+      if (!current)
+        return 0;
+
+      std::lock_guard<std::mutex> lock(current->mutex);
+
+      return current->sign_changes.size();
+    }
+  };
+
+  SignChangeCache sign_change_cache;
+
+  // Number of intervals rejected by the sign of the first term before Sturm counting, and the ones passed to it, counted per thread
+  struct QuickRejectHit;
+  struct QuickRejectMiss;
+
+  typedef ThreadLocalCounter<QuickRejectHit> QuickRejectHitCounter;
+  typedef ThreadLocalCounter<QuickRejectMiss> QuickRejectMissCounter;
+
   /*
   *  Sequence of p_i, which starts with polynomial p_0, p_1 from differential of p_0 and p_i following p_(i + 1) = -(p_i % p_(i - 1)).
   * 
   *  Make the polynomial monic after calculating modulo to reduce coefficients growth.
   */
-  static std::vector<UnivariatePolynomial<K>> negative_polynomial_reminder_sequence_with_to_monic(const UnivariatePolynomial<K> p_old, const UnivariatePolynomial<K> p_new)
+  static std::vector<UnivariatePolynomial<K>> negative_polynomial_reminder_sequence_with_to_monic(UnivariatePolynomial<K> p_old, UnivariatePolynomial<K> p_new)
   {
-    if (p_new == 0)
-      return {p_old};
+    std::vector<UnivariatePolynomial<K>> sequence;
 
-    auto reminder = p_old % p_new;
+    // Degree decreases at least one by each step
+    sequence.reserve(std::max(p_old.degree(), 0) + 2);
 
-    int sign = reminder.leading_coefficient().sign();
+    while (p_new != 0)
+    {
+      Budget::charge();
 
-    auto tail = negative_polynomial_reminder_sequence_with_to_monic(p_new, -reminder.to_monic() * UnivariatePolynomial<Rational>(sign)); // Loop is better (fast & understandable)?
+      auto reminder = p_old % p_new;
 
-    tail.insert(tail.begin(), p_old); // push_front() of std::list is faster than std::vector ?
+      int sign = reminder.leading_coefficient().sign();
 
-    return tail;
+      sequence.push_back(std::move(p_old));
+      p_old = std::move(p_new);
+
+      if (reminder == 0)
+        break;
+
+      p_new = -reminder.to_monic() * UnivariatePolynomial<K>(sign);
+    }
+
+    sequence.push_back(std::move(p_old));
+
+    return sequence;
+  }
+
+  void initialize_signs_at_infinity()
+  {
+    signs_at_positive_infinity.resize(sequence_terms.size());
+    signs_at_negative_infinity.resize(sequence_terms.size());
+
+    for (size_t i = 0; i < sequence_terms.size(); i++)
+    {
+      const int leading_sign = sequence_terms.at(i).leading_coefficient().sign();
+
+      signs_at_positive_infinity.at(i) = leading_sign;
+      signs_at_negative_infinity.at(i) = leading_sign * IntegerUtils::minus_one_power(sequence_terms.at(i).degree());
+    }
+  }
+
+  // Whether the pair of signs of adjacent terms is counted as a sign change
+  static bool is_sign_change(const int previous_sign, const int next_sign)
+  {
+    return (previous_sign == 1 && next_sign <= 0) || (previous_sign < 0 && next_sign >= 0);
   }
 
   /*
   *   Note: "variance" is the name used for this function in the source:
   *   https://miz-ar.info/math/algebraic-real/posts/02-real-root-counting.html
   */
-  static int count_sign_change(const std::vector<int> sign)
+  static int count_sign_change(const std::vector<int> &sign)
   {
     int count = 0;
 
-    for (size_t i = 0; i < sign.size() - 1; i++)
+    for (size_t i = 0; i + 1 < sign.size(); i++)
     {
-      if ((sign[i] == 1 && sign[i + 1] <= 0) || (sign[i] < 0 && sign[i + 1] >= 0))
+      if (is_sign_change(sign[i], sign[i + 1]))
         count++;
     }
 
@@ -60,7 +237,44 @@ public:
   SturmSequence() {} // For zero polynomial
 
   SturmSequence(UnivariatePolynomial<K> first_term)
-      : sequence_terms(negative_polynomial_reminder_sequence_with_to_monic(first_term, first_term.differential())) {}
+      : sequence_terms(negative_polynomial_reminder_sequence_with_to_monic(first_term, first_term.differential())),
+        filtered_sequence_terms(map_into_filtered(sequence_terms))
+  {
+    initialize_signs_at_infinity();
+    sign_change_cache.is_shared_with_copies = first_term.degree() > 1;
+  }
+
+  /*
+  *  Sturm sequence whose terms after the first one are computed over integers by signed subresultants.
+  *  Each term is a positive multiple of the term computed over rational, so sign changes are the same.
+  *  It avoids rational division and to_monic at each step.
+  */
+  static SturmSequence from_signed_subresultants(const UnivariatePolynomial<K> &first_term)
+  {
+    const auto integer_first_term = IntegerPolynomial::primitive_part(first_term);
+    const auto integer_terms = PolynomialRemainderSequence::signed_subresultant_polynomial_remainder_sequence(integer_first_term, integer_first_term.differential());
+
+    SturmSequence sturm_sequence;
+
+    sturm_sequence.sequence_terms.reserve(integer_terms.size());
+    sturm_sequence.sequence_terms.push_back(first_term);
+
+    for (size_t i = 1; i < integer_terms.size(); i++)
+    {
+      std::vector<K> term_a(integer_terms.at(i).a.size());
+
+      std::transform(integer_terms.at(i).a.begin(), integer_terms.at(i).a.end(), term_a.begin(), [](const boost::multiprecision::cpp_int &c)
+                     { return K(c, 1); });
+
+      sturm_sequence.sequence_terms.emplace_back(std::move(term_a));
+    }
+
+    sturm_sequence.filtered_sequence_terms = map_into_filtered(sturm_sequence.sequence_terms);
+    sturm_sequence.initialize_signs_at_infinity();
+    sturm_sequence.sign_change_cache.is_shared_with_copies = first_term.degree() > 1;
+
+    return sturm_sequence;
+  }
 
   // The first term of Strum sequence is the original polynomial.
   UnivariatePolynomial<K> first_term() const
@@ -68,6 +282,18 @@ public:
     return sequence_terms.at(0);
   }
 
+  // Primitive integer copy of the first term, which is a positive multiple of it.
+  const UnivariatePolynomial<boost::multiprecision::cpp_int> &first_term_integer() const
+  {
+    return filtered_sequence_terms.at(0).integer();
+  }
+
+  // Sign of the first term at certain number, evaluated on its filtered integer copy.
+  int first_term_sign_at(const K r) const
+  {
+    return filtered_sequence_terms.at(0).sign_at(r);
+  }
+
   friend std::ostream &operator<<(std::ostream &os, const SturmSequence &s)
   {
     os << "Sturm |";
@@ -83,25 +309,159 @@ public:
   // Count the number of sign change of polynomial sequence at certain number.
   int count_sign_change_at(const K r) const
   {
-    std::vector<int> signs(sequence_terms.size());
-    std::transform(sequence_terms.begin(), sequence_terms.end(), signs.begin(), [r](UnivariatePolynomial<K> p)
-                   { return p.sign_at(r); });
-    return count_sign_change(signs);
+    int count = 0, previous_sign = 0;
+
+    for (size_t i = 0; i < filtered_sequence_terms.size(); i++)
+    {
+      const int sign = filtered_sequence_terms[i].sign_at(r);
+
+      if (i > 0 && is_sign_change(previous_sign, sign))
+        count++;
+
+      previous_sign = sign;
+    }
+
+    return count;
+  }
+
+  // Count the number of sign change at certain number. The result is memoized, so an endpoint is evaluated only once.
+  int memoized_count_sign_change_at(const K &r) const
+  {
+    if (int sign_change; sign_change_cache.find(r, sign_change))
+      return sign_change;
+
+    // Evaluate without the lock, so other threads are not blocked
+    const int sign_change = count_sign_change_at(r);
+
+    sign_change_cache.insert(r, sign_change);
+
+    return sign_change;
+  }
+
+  // Number of endpoints whose sign changes are memoized, which is zero until the first memoized evaluation
+  size_t memoized_endpoint_count() const
+  {
+    return sign_change_cache.size();
+  }
+
+  /*
+  *  Count the number of sign change at each of many points.
+  *  Every term is evaluated at all points together on the floating-point filter. When the filter fails at a point,
+  *  the powers of its numerator and denominator are computed once and shared by the following terms of lower degree.
+  */
+  std::vector<int> count_sign_changes_at(const std::vector<K> &points) const
+  {
+    std::vector<double> approximate_points(points.size());
+
+    std::transform(points.begin(), points.end(), approximate_points.begin(), FloatingPointHorner::approximate);
+
+    const int maximum_degree = filtered_sequence_terms.empty() ? 0 : filtered_sequence_terms.front().integer().degree();
+
+    std::vector<std::pair<std::vector<boost::multiprecision::cpp_int>, std::vector<boost::multiprecision::cpp_int>>> power_tables(points.size());
+
+    std::vector<int> counts(points.size(), 0), previous_signs(points.size(), 0);
+
+    for (size_t i = 0; i < filtered_sequence_terms.size(); i++)
+    {
+      const auto &term = filtered_sequence_terms[i].integer();
+
+      const auto signs = filtered_sequence_terms[i].sign_at(approximate_points, [&](const size_t j)
+                                                            {
+                                                              if (power_tables[j].first.empty())
+                                                                power_tables[j] = IntegerPolynomial::power_tables(points[j], maximum_degree);
+
+                                                              return IntegerPolynomial::sign_at(term, power_tables[j].first, power_tables[j].second);
+                                                            });
+
+      for (size_t j = 0; j < points.size(); j++)
+      {
+        if (i > 0 && is_sign_change(previous_signs[j], signs[j]))
+          counts[j]++;
+
+        previous_signs[j] = signs[j];
+      }
+    }
+
+    return counts;
+  }
+
+  // Signs of every term at many points. signs_at(points).at(i).at(j) is the sign of i-th term at j-th point.
+  std::vector<std::vector<int>> signs_at(const std::vector<K> &points) const
+  {
+    std::vector<std::vector<int>> signs(filtered_sequence_terms.size());
+    std::transform(filtered_sequence_terms.begin(), filtered_sequence_terms.end(), signs.begin(), [&points](const FilteredPolynomial &p)
+                   { return p.sign_at(points); });
+    return signs;
   }
 
   // Count the number of sign change of polynomial sequence at certain extended number.
   int count_sign_change_at_extended(const Extended<K> e) const
   {
-    std::vector<int> signs(sequence_terms.size());
-    std::transform(sequence_terms.begin(), sequence_terms.end(), signs.begin(), [e](UnivariatePolynomial<K> p)
-                   { return p.sign_at_extended(e); });
-    return count_sign_change(signs);
+    if (e.is_finite())
+      return count_sign_change_at(e.get_finite_number());
+
+    return count_sign_change(e > 0 ? signs_at_positive_infinity : signs_at_negative_infinity);
+  }
+
+  /*
+  *  Whether the first term has no root in [r1, r2], decided in O(n) by interval Horner's rule on its floating-point image.
+  *  Such an interval is rejected without evaluating the sequence.
+  */
+  bool is_quickly_rejected(const K &r1, const K &r2) const
+  {
+    if (filtered_sequence_terms.empty())
+      return false;
+
+    if (filtered_sequence_terms.front().approximate_sign_on(r1, r2))
+    {
+      QuickRejectHitCounter::increment();
+      return true;
+    }
+
+    QuickRejectMissCounter::increment();
+    return false;
   }
 
   // Compute the number of real roots in an interval.
   int count_real_roots_between(const K r1, const K r2) const
   {
-    return count_sign_change_at(r1) - count_sign_change_at(r2);
+    if (is_quickly_rejected(r1, r2))
+      return 0;
+
+    return memoized_count_sign_change_at(r1) - memoized_count_sign_change_at(r2);
+  }
+
+  /*
+  *  Compute the number of real roots in each of many intervals (r1, r2].
+  *  Distinct endpoints are evaluated once by count_sign_changes_at.
+  */
+  std::vector<int> count_real_roots_between(const std::vector<std::pair<K, K>> &intervals) const
+  {
+    std::vector<K> endpoints;
+    endpoints.reserve(intervals.size() * 2);
+
+    for (const auto &[r1, r2] : intervals)
+    {
+      endpoints.push_back(r1);
+      endpoints.push_back(r2);
+    }
+
+    std::sort(endpoints.begin(), endpoints.end());
+    endpoints.erase(std::unique(endpoints.begin(), endpoints.end()), endpoints.end());
+
+    const auto sign_changes = count_sign_changes_at(endpoints);
+
+    const auto sign_change_at = [&](const K &r)
+    {
+      return sign_changes[std::lower_bound(endpoints.begin(), endpoints.end(), r) - endpoints.begin()];
+    };
+
+    std::vector<int> counts(intervals.size());
+
+    std::transform(intervals.begin(), intervals.end(), counts.begin(), [&](const std::pair<K, K> &interval)
+                   { return sign_change_at(interval.first) - sign_change_at(interval.second); });
+
+    return counts;
   }
 
   // Compute the number of real roots in an interval including infinite boundary.
@@ -124,11 +484,12 @@ public:
   {
     auto [r1, r2] = old_interval;
 
-    const int sign_change_at_r1 = count_sign_change_at(r1);
+    // The end which was the middle in the previous step is found in cache
+    const int sign_change_at_r1 = memoized_count_sign_change_at(r1);
 
     const K r_middle = (r1 + r2) / 2;
 
-    const int sign_change_at_r_middle = count_sign_change_at(r_middle);
+    const int sign_change_at_r_middle = memoized_count_sign_change_at(r_middle);
 
     if (sign_change_at_r1 == sign_change_at_r_middle)
     {
@@ -139,4 +500,45 @@ public:
       return {r1, r_middle};
     }
   }
+
+  /*
+  *  Next step of bisection which carries sign changes at both ends of the interval.
+  *  Each step costs exactly one evaluation at the middle.
+  */
+  std::pair<std::pair<K, K>, std::pair<int, int>> next_interval(const std::pair<K, K> &old_interval, const std::pair<int, int> &old_sign_changes) const
+  {
+    const auto &[r1, r2] = old_interval;
+    const auto &[sign_change_at_r1, sign_change_at_r2] = old_sign_changes;
+
+    const K r_middle = (r1 + r2) / 2;
+
+    const int sign_change_at_r_middle = memoized_count_sign_change_at(r_middle);
+
+    if (sign_change_at_r1 == sign_change_at_r_middle)
+    {
+      return {{r_middle, r2}, {sign_change_at_r_middle, sign_change_at_r2}};
+    }
+    else
+    {
+      return {{r1, r_middle}, {sign_change_at_r1, sign_change_at_r_middle}};
+    }
+  }
+
+  // Number of intervals rejected before Sturm counting
+  static unsigned long long quick_reject_hits()
+  {
+    return QuickRejectHitCounter::total();
+  }
+
+  // Number of intervals which needed Sturm counting
+  static unsigned long long quick_reject_misses()
+  {
+    return QuickRejectMissCounter::total();
+  }
+
+  static void reset_quick_reject_counters()
+  {
+    QuickRejectHitCounter::reset();
+    QuickRejectMissCounter::reset();
+  }
 };
\ No newline at end of file
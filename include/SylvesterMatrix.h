@@ -1,6 +1,9 @@
+#pragma once
+
 #include <boost/multiprecision/cpp_int.hpp>
 
 #include <AliasMonomial.h>
+#include <Budget.h>
 #include <IntegerUtils.h>
 #include <Rational.h>
 #include <UnivariatePolynomial.h>
@@ -17,6 +20,8 @@ private:
     if (g.degree() == 0)
       return p * g.leading_coefficient().pow(f.degree());
 
+    Budget::charge();
+
     auto remainder = f % g;
 
     if (remainder == 0)
@@ -59,6 +64,8 @@ public:
     if (g.degree() == 0)
       return IntegerUtils::pow(g.leading_coefficient(), f.degree());
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -90,6 +97,8 @@ public:
     if (g.degree() == 0)
       return g.leading_coefficient().pow(f.degree());
 
+    Budget::charge();
+
     auto remainder = f.pseudo_mod(g);
 
     if (remainder == 0)
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+*  Work-stealing pool of worker threads.
+*
+*  Each worker has its own deque. A worker pops its newest task (depth-first, cache friendly)
+*  and steals the oldest task of another worker (largest remaining work) when its own deque is empty.
+*  A thread waiting for a condition runs queued tasks meanwhile and sleeps only while no task is queued,
+*  so nested parallelism never deadlocks.
+*/
+class TaskPool
+{
+private:
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  std::vector<std::thread> workers;
+
+  std::atomic<bool> is_stopping{false};
+  // Signed because a task can be popped before its submission is counted
+  std::atomic<long> queued_count{0};
+  std::atomic<size_t> next_queue{0};
+
+  std::mutex sleep_mutex;
+  std::condition_variable sleep_condition;
+
+  // Index of queue owned by current thread, or -1 when the thread is not a worker of this pool
+  static thread_local const TaskPool *current_pool;
+  static thread_local int current_worker;
+
+  // Pop own task or steal another one, and run it. Return false when there is no task.
+  bool run_one(const int home);
+
+  void work(const int index);
+
+public:
+  explicit TaskPool(const unsigned worker_count);
+  ~TaskPool();
+
+  TaskPool(const TaskPool &) = delete;
+  TaskPool &operator=(const TaskPool &) = delete;
+
+  // Pool shared by the library with one worker per hardware thread
+  static TaskPool &shared();
+
+  unsigned size() const;
+
+  // Push into the deque of current worker (or any deque from outside of the pool)
+  void submit(std::function<void()> task);
+
+  /*
+  *  Run queued tasks on the calling thread until is_done returns true. Without a queued task, the thread sleeps
+  *  until a task is submitted or notify_done() is called, so anything making is_done true must call notify_done() after it.
+  */
+  void help_until(const std::function<bool()> &is_done);
+
+  // Wake the threads sleeping in help_until to check their conditions again
+  void notify_done();
+};
+
+/*
+*  Set of tasks waited together. The first exception thrown by the tasks is rethrown by wait().
+*  Each task runs under the Budget installed on the thread which called run().
+*/
+class TaskGroup
+{
+private:
+  TaskPool &pool;
+
+  std::atomic<int> pending_count{0};
+
+  std::mutex error_mutex;
+  std::exception_ptr error;
+
+public:
+  explicit TaskGroup(TaskPool &pool) : pool(pool){};
+
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+
+  ~TaskGroup();
+
+  void run(std::function<void()> task);
+
+  void wait();
+};
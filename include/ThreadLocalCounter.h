@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+/*
+*  Statistics counter incremented from many threads, one counter per Tag type.
+*
+*  Each thread increments its own slot on its own cache line, so hot loops running on all workers of TaskPool
+*  neither contend nor pay for a locked read-modify-write. Reading sums the slots of all threads which ever counted,
+*  including finished ones. Reset is meant for the time when no thread is counting.
+*/
+template <class Tag>
+class ThreadLocalCounter
+{
+private:
+  struct alignas(64) Slot
+  {
+    std::atomic<unsigned long long> count{0};
+  };
+
+  static inline std::mutex slots_mutex;
+  // Deque keeps the address of each slot while others are added
+  static inline std::deque<Slot> slots;
+
+  static Slot &local_slot()
+  {
+    thread_local Slot *slot = []
+    {
+      std::lock_guard<std::mutex> lock(slots_mutex);
+      return &slots.emplace_back();
+    }();
+
+    return *slot;
+  }
+
+public:
+  static void increment()
+  {
+    std::atomic<unsigned long long> &count = local_slot().count;
+
+    // Only the owner thread writes, so relaxed load and store are enough
+    count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  static unsigned long long total()
+  {
+    std::lock_guard<std::mutex> lock(slots_mutex);
+
+    unsigned long long sum = 0;
+
+    for (const auto &each_slot : slots)
+    {
+      sum += each_slot.count.load(std::memory_order_relaxed);
+    }
+
+    return sum;
+  }
+
+  static void reset()
+  {
+    std::lock_guard<std::mutex> lock(slots_mutex);
+
+    for (auto &each_slot : slots)
+    {
+      each_slot.count.store(0, std::memory_order_relaxed);
+    }
+  }
+};
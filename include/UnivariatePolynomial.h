@@ -87,6 +87,34 @@ public:
     return accumulator;
   }
 
+  /*
+  *   Power this^index modulo non-constant modulus by repeated squaring.
+  *   Every intermediate product is reduced, so its degree stays below 2 * degree modulus and O(log index) products are taken.
+  */
+  UnivariatePolynomial pow_mod(boost::multiprecision::cpp_int index, const UnivariatePolynomial &modulus) const
+  {
+    if (index < 0)
+      throw std::domain_error("Negative power of polynomial error");
+
+    if (modulus.degree() <= 0)
+      throw std::domain_error("Modulus of power must be non-constant polynomial");
+
+    UnivariatePolynomial accumulator = UnivariatePolynomial(1) % modulus, square = *this % modulus;
+
+    while (index > 0)
+    {
+      if (index & 1)
+        accumulator = accumulator * square % modulus;
+
+      index >>= 1;
+
+      if (index > 0)
+        square = square * square % modulus;
+    }
+
+    return accumulator;
+  }
+
   UnivariatePolynomial operator+() const { return UnivariatePolynomial<K>(*this); }
   UnivariatePolynomial operator-() const { return UnivariatePolynomial<K>(*this) *= -1; }
 
@@ -337,3 +365,48 @@ UnivariatePolynomial<K> square_free(const UnivariatePolynomial<K> &p)
 {
   return p / gcd(p, p.differential());
 }
+
+/*
+*  Coprime basis (gcd-free basis) of polynomials: pairwise coprime monic square-free polynomials of positive degree
+*  such that square-free part of each input is a product of some of them.
+*
+*  Each square-free input f is split against each basis element b by g = gcd(f, b): b is replaced by b / g and g,
+*  and f / g goes on to the next element. They stay coprime because b and f are square-free.
+*/
+template <class K>
+std::vector<UnivariatePolynomial<K>> coprime_basis(const std::vector<UnivariatePolynomial<K>> &polynomials)
+{
+  std::vector<UnivariatePolynomial<K>> basis;
+
+  for (const auto &p : polynomials)
+  {
+    if (p.degree() <= 0)
+      continue;
+
+    UnivariatePolynomial<K> rest = square_free(p).to_monic();
+
+    for (size_t b_i = 0; b_i < basis.size() && rest.degree() > 0; b_i++)
+    {
+      const UnivariatePolynomial<K> g = gcd(basis.at(b_i), rest).to_monic();
+
+      if (g.degree() <= 0)
+        continue;
+
+      rest = (rest / g).to_monic();
+
+      const UnivariatePolynomial<K> cofactor = (basis.at(b_i) / g).to_monic();
+
+      if (cofactor.degree() > 0)
+      {
+        basis.at(b_i) = cofactor;
+        basis.insert(basis.begin() + b_i + 1, g);
+        b_i++; // g is coprime to the rest
+      }
+    }
+
+    if (rest.degree() > 0)
+      basis.push_back(rest);
+  }
+
+  return basis;
+}
@@ -0,0 +1,343 @@
+#include <atomic>
+#include <cmath>
+#include <mutex>
+
+#include <AlgebraicExpr.h>
+#include <Budget.h>
+#include <IntegerPolynomial.h>
+
+static std::atomic<unsigned long long> materialization_counter{0};
+
+// log2 of the Euclidean norm of integer polynomial, which bounds its Mahler measure (Landau's inequality)
+static double log2_norm(const UnivariatePolynomial<boost::multiprecision::cpp_int> &p)
+{
+  boost::multiprecision::cpp_int square_norm = 0;
+
+  for (const auto &each_a : p.a)
+  {
+    square_norm += each_a * each_a;
+  }
+
+  if (square_norm == 0)
+    return 0;
+
+  return (boost::multiprecision::msb(square_norm) + 1) / 2.0;
+}
+
+struct AlgebraicExpr::Node
+{
+  enum class Operation
+  {
+    Leaf,
+    Negate,
+    Add,
+    Subtract,
+    Multiply,
+    Divide
+  };
+
+  const Operation operation;
+  const AlgebraicReal leaf;
+  const std::shared_ptr<const Node> left, right;
+
+  // Degree and log2 of Mahler measure of an integer polynomial which vanishes at the value
+  double degree_bound, log_measure_bound;
+
+  mutable std::mutex cache_mutex;
+  // Isolating interval of leaf refined so far, and N of QIR reached by its refinement
+  mutable IntervalRational leaf_interval = 0;
+  mutable boost::multiprecision::cpp_int leaf_subinterval_count = AlgebraicReal::initial_subinterval_count;
+  // Result of the last evaluation, which is shared by the parents in the DAG
+  mutable int evaluated_precision = -1;
+  mutable std::optional<IntervalRational> evaluated_interval;
+  mutable std::optional<AlgebraicReal> materialized;
+
+  Node(const AlgebraicReal &a) : operation(Operation::Leaf), leaf(a), leaf_interval(a.get_interval().first, a.get_interval().second)
+  {
+    if (a.get_from_rational())
+    {
+      // Root of q x - p
+      const Rational r = a.rational();
+
+      degree_bound = 1;
+      log_measure_bound = log2_norm(UnivariatePolynomial<boost::multiprecision::cpp_int>({boost::multiprecision::cpp_int(-r.get_numerator()), r.get_denominator()}));
+    }
+    else
+    {
+      const auto integer_polynomial = IntegerPolynomial::primitive_part(a.defining_polynomial());
+
+      degree_bound = integer_polynomial.degree();
+      log_measure_bound = log2_norm(integer_polynomial);
+    }
+  }
+
+  /*
+  *   Bounds of measure follow from the resultants giving the polynomials (Mignotte):
+  *
+  *     M(-a) = M(1 / a) = M(a),   M(a b) <= M(a)^deg(b) M(b)^deg(a),   M(a + b) <= M(a)^deg(b) M(b)^deg(a) 2^(deg(a) deg(b))
+  */
+  Node(const Operation operation, const std::shared_ptr<const Node> &left, const std::shared_ptr<const Node> &right)
+      : operation(operation), left(left), right(right)
+  {
+    if (operation == Operation::Negate)
+    {
+      degree_bound = left->degree_bound;
+      log_measure_bound = left->log_measure_bound;
+      return;
+    }
+
+    degree_bound = left->degree_bound * right->degree_bound;
+    log_measure_bound = right->degree_bound * left->log_measure_bound + left->degree_bound * right->log_measure_bound;
+
+    if (operation == Operation::Add || operation == Operation::Subtract)
+      log_measure_bound += degree_bound;
+  }
+
+  std::optional<IntervalRational> evaluate(const int precision) const
+  {
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+
+      if (evaluated_precision == precision)
+        return evaluated_interval;
+    }
+
+    std::optional<IntervalRational> value;
+
+    if (operation == Operation::Leaf)
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+
+      leaf_interval = leaf.refine_to(leaf_interval, Rational(1, boost::multiprecision::cpp_int(1) << precision), leaf_subinterval_count);
+      value = leaf_interval;
+    }
+    else if (operation == Operation::Negate)
+    {
+      if (const auto left_value = left->evaluate(precision))
+        value = IntervalRational(0) - *left_value;
+    }
+    else
+    {
+      const auto left_value = left->evaluate(precision), right_value = right->evaluate(precision);
+
+      if (left_value && right_value)
+      {
+        switch (operation)
+        {
+        case Operation::Add:
+          value = *left_value + *right_value;
+          break;
+        case Operation::Subtract:
+          value = *left_value - *right_value;
+          break;
+        case Operation::Multiply:
+          value = *left_value * *right_value;
+          break;
+        default:
+          // Division is undecided while the divisor may be zero
+          if (right_value->first() > 0 || right_value->second() < 0)
+            value = *left_value / *right_value;
+          break;
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    evaluated_precision = precision;
+    evaluated_interval = value;
+
+    return value;
+  }
+
+  AlgebraicReal materialize() const
+  {
+    if (operation == Operation::Leaf)
+      return leaf;
+
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex);
+
+      if (materialized)
+        return *materialized;
+    }
+
+    AlgebraicReal value;
+
+    switch (operation)
+    {
+    case Operation::Negate:
+      value = -left->materialize();
+      break;
+    case Operation::Add:
+      value = left->materialize() + right->materialize();
+      break;
+    case Operation::Subtract:
+      value = left->materialize() - right->materialize();
+      break;
+    case Operation::Multiply:
+      value = left->materialize() * right->materialize();
+      break;
+    default:
+      value = left->materialize() / right->materialize();
+      break;
+    }
+
+    materialization_counter++;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+
+    materialized = value;
+
+    return value;
+  }
+
+  void print(std::ostream &os) const
+  {
+    switch (operation)
+    {
+    case Operation::Leaf:
+      os << leaf;
+      break;
+    case Operation::Negate:
+      os << "-(";
+      left->print(os);
+      os << ")";
+      break;
+    default:
+      const char *symbol = operation == Operation::Add ? " + " : operation == Operation::Subtract ? " - "
+                                                             : operation == Operation::Multiply   ? " * "
+                                                                                                  : " / ";
+      os << "(";
+      left->print(os);
+      os << symbol;
+      right->print(os);
+      os << ")";
+      break;
+    }
+  }
+};
+
+AlgebraicExpr::AlgebraicExpr() : AlgebraicExpr(0){};
+
+AlgebraicExpr::AlgebraicExpr(const int n) : AlgebraicExpr(AlgebraicReal(n)){};
+
+AlgebraicExpr::AlgebraicExpr(const Rational &r) : AlgebraicExpr(AlgebraicReal(r)){};
+
+AlgebraicExpr::AlgebraicExpr(const AlgebraicReal &a) : node(std::make_shared<const Node>(a)){};
+
+AlgebraicExpr AlgebraicExpr::operator+() const
+{
+  return *this;
+}
+
+AlgebraicExpr AlgebraicExpr::operator-() const
+{
+  return AlgebraicExpr(std::make_shared<const Node>(Node::Operation::Negate, node, nullptr));
+}
+
+AlgebraicExpr &AlgebraicExpr::operator+=(const AlgebraicExpr &e)
+{
+  node = std::make_shared<const Node>(Node::Operation::Add, node, e.node);
+
+  return *this;
+}
+
+AlgebraicExpr &AlgebraicExpr::operator-=(const AlgebraicExpr &e)
+{
+  node = std::make_shared<const Node>(Node::Operation::Subtract, node, e.node);
+
+  return *this;
+}
+
+AlgebraicExpr &AlgebraicExpr::operator*=(const AlgebraicExpr &e)
+{
+  node = std::make_shared<const Node>(Node::Operation::Multiply, node, e.node);
+
+  return *this;
+}
+
+AlgebraicExpr &AlgebraicExpr::operator/=(const AlgebraicExpr &e)
+{
+  node = std::make_shared<const Node>(Node::Operation::Divide, node, e.node);
+
+  return *this;
+}
+
+bool operator<(const AlgebraicExpr &e1, const AlgebraicExpr &e2)
+{
+  return (e1 - e2).sign() < 0;
+}
+
+bool operator==(const AlgebraicExpr &e1, const AlgebraicExpr &e2)
+{
+  if (e1.node == e2.node)
+    return true;
+
+  return (e1 - e2).sign() == 0;
+}
+
+std::ostream &operator<<(std::ostream &os, const AlgebraicExpr &e)
+{
+  os << "AlgExpr ";
+  e.node->print(os);
+
+  return os;
+}
+
+std::optional<IntervalRational> AlgebraicExpr::evaluate(const int precision) const
+{
+  return node->evaluate(precision);
+}
+
+double AlgebraicExpr::separation_bits() const
+{
+  return node->log_measure_bound;
+}
+
+int AlgebraicExpr::sign() const
+{
+  const double bound = separation_bits();
+
+  for (int precision = initial_precision; precision <= max_precision; precision *= 2)
+  {
+    Budget::charge();
+
+    const auto ivr = evaluate(precision);
+
+    if (!ivr)
+      continue;
+
+    if (ivr->first() > 0)
+      return 1;
+
+    if (ivr->second() < 0)
+      return -1;
+
+    // Interval around zero narrower than the separation bound holds only zero. Comparison is false for infinite bound.
+    if (bound < max_precision)
+    {
+      const int bound_bits = std::max(0, static_cast<int>(std::ceil(bound)));
+
+      if ((ivr->second() - ivr->first()) * Rational(boost::multiprecision::cpp_int(1) << bound_bits, 1) < 1)
+        return 0;
+    }
+  }
+
+  return materialize().sign();
+}
+
+AlgebraicReal AlgebraicExpr::materialize() const
+{
+  return node->materialize();
+}
+
+unsigned long long AlgebraicExpr::materialization_count()
+{
+  return materialization_counter;
+}
+
+void AlgebraicExpr::reset_materialization_count()
+{
+  materialization_counter = 0;
+}
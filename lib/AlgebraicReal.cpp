@@ -1,11 +1,22 @@
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 
+#include <AberthIsolation.h>
 #include <AliasMonomial.h>
 #include <AliasExtended.h>
 #include <AlgebraicReal.h>
+#include <BitstreamDescartes.h>
+#include <Budget.h>
+#include <ContinuedFractionIsolation.h>
+#include <DescartesIsolation.h>
+#include <Factorization.h>
+#include <IntegerPolynomial.h>
+#include <RootBound.h>
 #include <SturmSequence.h>
 #include <SylvesterMatrix.h>
+#include <TaskPool.h>
 #include <UnivariatePolynomial.h>
 
 bool AlgebraicReal::is_overlapping(const std::pair<Rational, Rational> i1, const std::pair<Rational, Rational> i2)
@@ -67,13 +78,21 @@ AlgebraicReal::AlgebraicReal(const UnivariatePolynomial<Rational> &defining_poly
 
     this->defining_polynomial_sturm_sequence = sturm_sequence_without_zero;
 
-    // Converge interval until not contain zero
+    // Converge interval until not contain zero, carrying sign changes at both ends so that each step evaluates only the middle
+    std::pair<int, int> sign_changes;
+
+    if (lower_bound < 0 && 0 < upper_bound)
+      sign_changes = {sturm_sequence_without_zero.count_sign_change_at(lower_bound), sturm_sequence_without_zero.count_sign_change_at(upper_bound)};
+
     while (lower_bound < 0 && 0 < upper_bound)
     {
+      Budget::charge();
+
       // TODO: make sure interval have just 1 root
-      auto next_interval = sturm_sequence_without_zero.next_interval({lower_bound, upper_bound});
+      const auto [next_interval, next_sign_changes] = sturm_sequence_without_zero.next_interval({lower_bound, upper_bound}, sign_changes);
       lower_bound = next_interval.first;
       upper_bound = next_interval.second;
+      sign_changes = next_sign_changes;
     }
 
     this->interval = interval;
@@ -89,6 +108,23 @@ AlgebraicReal::AlgebraicReal(const UnivariatePolynomial<Rational> &defining_poly
   }
 }
 
+AlgebraicReal::AlgebraicReal(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> &interval)
+{
+  const auto [lower_bound, upper_bound] = interval;
+
+  // Root at zero or at upper bound is rational, and zero root needs the polynomial without it
+  if (upper_bound < lower_bound || sturm_sequence.first_term_integer().a.at(0) == 0 || sturm_sequence.first_term_sign_at(upper_bound) == 0)
+  {
+    *this = AlgebraicReal(sturm_sequence.first_term(), interval);
+    return;
+  }
+
+  from_rational = false;
+  defining_polynomial_sturm_sequence = sturm_sequence;
+  this->interval = interval;
+  sign_at_upper = sturm_sequence.first_term_sign_at(upper_bound);
+}
+
 AlgebraicReal AlgebraicReal::operator+() const
 {
   return AlgebraicReal(*this);
@@ -143,10 +179,17 @@ AlgebraicReal AlgebraicReal::operator+=(const AlgebraicReal &a)
                                            .to_monic())
                                        .to_monic();
 
-    while (SturmSequence(new_defining_polynomial).count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
+    const SturmSequence new_sturm_sequence(new_defining_polynomial);
+    Rational width = std::max(ivr.second() - ivr.first(), a_ivr.second() - a_ivr.first());
+    boost::multiprecision::cpp_int subinterval_count = initial_subinterval_count, a_subinterval_count = initial_subinterval_count;
+
+    while (new_sturm_sequence.count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
     {
-      ivr = next_interval(ivr);
-      a_ivr = a.next_interval(a_ivr);
+      Budget::charge();
+
+      width = next_target_width(width);
+      ivr = refine_to(ivr, width, subinterval_count);
+      a_ivr = a.refine_to(a_ivr, width, a_subinterval_count);
       new_ivr = ivr + a_ivr;
     }
 
@@ -190,10 +233,17 @@ AlgebraicReal AlgebraicReal::operator-=(const AlgebraicReal &a)
                                                    .to_monic())
                                        .to_monic();
 
-    while (SturmSequence(new_defining_polynomial).count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
+    const SturmSequence new_sturm_sequence(new_defining_polynomial);
+    Rational width = std::max(ivr.second() - ivr.first(), a_ivr.second() - a_ivr.first());
+    boost::multiprecision::cpp_int subinterval_count = initial_subinterval_count, a_subinterval_count = initial_subinterval_count;
+
+    while (new_sturm_sequence.count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
     {
-      ivr = next_interval(ivr);
-      a_ivr = a.next_interval(a_ivr);
+      Budget::charge();
+
+      width = next_target_width(width);
+      ivr = refine_to(ivr, width, subinterval_count);
+      a_ivr = a.refine_to(a_ivr, width, a_subinterval_count);
       new_ivr = ivr - a_ivr;
     }
 
@@ -268,10 +318,17 @@ AlgebraicReal AlgebraicReal::operator*=(const AlgebraicReal &a)
                                                    .to_monic())
                                        .to_monic();
 
-    while (SturmSequence(new_defining_polynomial).count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
+    const SturmSequence new_sturm_sequence(new_defining_polynomial);
+    Rational width = std::max(ivr.second() - ivr.first(), a_ivr.second() - a_ivr.first());
+    boost::multiprecision::cpp_int subinterval_count = initial_subinterval_count, a_subinterval_count = initial_subinterval_count;
+
+    while (new_sturm_sequence.count_real_roots_between(new_ivr.first(), new_ivr.second()) >= 2)
     {
-      ivr = next_interval(ivr);
-      a_ivr = a.next_interval(a_ivr);
+      Budget::charge();
+
+      width = next_target_width(width);
+      ivr = refine_to(ivr, width, subinterval_count);
+      a_ivr = a.refine_to(a_ivr, width, a_subinterval_count);
       new_ivr = ivr * a_ivr;
     }
 
@@ -343,7 +400,7 @@ bool operator<(const AlgebraicReal &a, const AlgebraicReal &b)
     if (b.interval.second < a.r)
       return false;
 
-    return a.defining_polynomial_sturm_sequence.count_real_roots_between(a.r, b.interval.second) == 1;
+    return b.defining_polynomial_sturm_sequence.count_real_roots_between(a.r, b.interval.second) == 1;
   }
 
   if (b.from_rational)
@@ -380,10 +437,16 @@ bool operator<(const AlgebraicReal &a, const AlgebraicReal &b)
     auto a_interval_rational = IntervalRational(a_interval.first, a_interval.second);
     auto b_interval_rational = IntervalRational(b_interval.first, b_interval.second);
 
+    Rational width = std::max(a_interval.second - a_interval.first, b_interval.second - b_interval.first);
+    boost::multiprecision::cpp_int a_subinterval_count = AlgebraicReal::initial_subinterval_count, b_subinterval_count = AlgebraicReal::initial_subinterval_count;
+
     while (!(a_interval_rational < b_interval_rational).determined())
     {
-      a_interval_rational = a.next_interval(a_interval_rational);
-      b_interval_rational = b.next_interval(b_interval_rational);
+      Budget::charge();
+
+      width = AlgebraicReal::next_target_width(width);
+      a_interval_rational = a.refine_to(a_interval_rational, width, a_subinterval_count);
+      b_interval_rational = b.refine_to(b_interval_rational, width, b_subinterval_count);
     }
 
     return (a_interval_rational < b_interval_rational).get_value();
@@ -497,11 +560,14 @@ IntervalRational AlgebraicReal::next_interval_with_sign(const IntervalRational &
 {
   auto middle = (ivr.first() + ivr.second()) / 2;
 
-  if (defining_polynomial().sign_at(middle) == 0)
+  // Irrational number evaluates sign on integer copy of the defining polynomial cached by Sturm sequence
+  const int sign_at_middle = from_rational ? defining_polynomial().sign_at(middle) : defining_polynomial_sturm_sequence.first_term_sign_at(middle);
+
+  if (sign_at_middle == 0)
   {
     return IntervalRational(middle);
   }
-  else if (sign_at_upper * defining_polynomial().sign_at(middle) < 0)
+  else if (sign_at_upper * sign_at_middle < 0)
   {
     return IntervalRational(middle, ivr.second());
   }
@@ -511,15 +577,131 @@ IntervalRational AlgebraicReal::next_interval_with_sign(const IntervalRational &
   }
 }
 
+std::optional<IntervalRational> AlgebraicReal::quadratic_refinement_step(const IntervalRational &ivr, const boost::multiprecision::cpp_int &subinterval_count) const
+{
+  const auto &integer_polynomial = defining_polynomial_sturm_sequence.first_term_integer();
+
+  const Rational lower = ivr.first(), upper = ivr.second();
+  const Rational value_at_lower = IntegerPolynomial::value_at(integer_polynomial, lower);
+  const Rational value_at_upper = IntegerPolynomial::value_at(integer_polynomial, upper);
+
+  // Secant needs sign change between both ends
+  if (value_at_lower.sign() * value_at_upper.sign() >= 0)
+    return std::nullopt;
+
+  // Secant crosses zero at lower + (upper - lower) * ratio where 0 < ratio < 1
+  const Rational ratio = value_at_lower / (value_at_lower - value_at_upper);
+
+  boost::multiprecision::cpp_int numerator = ratio.get_numerator() * subinterval_count, denominator = ratio.get_denominator();
+
+  if (denominator < 0)
+  {
+    numerator = -numerator;
+    denominator = -denominator;
+  }
+
+  const boost::multiprecision::cpp_int index = std::min(boost::multiprecision::cpp_int(numerator / denominator), boost::multiprecision::cpp_int(subinterval_count - 1));
+
+  const Rational step = (upper - lower) / Rational(subinterval_count, 1);
+  const Rational subinterval_lower = lower + step * Rational(index, 1);
+  const Rational subinterval_upper = subinterval_lower + step;
+
+  const int sign_at_subinterval_lower = index == 0 ? value_at_lower.sign() : IntegerPolynomial::sign_at(integer_polynomial, subinterval_lower);
+  const int sign_at_subinterval_upper = index == subinterval_count - 1 ? value_at_upper.sign() : IntegerPolynomial::sign_at(integer_polynomial, subinterval_upper);
+
+  if (sign_at_subinterval_upper == 0)
+    return IntervalRational(subinterval_upper);
+
+  if (sign_at_subinterval_lower * sign_at_subinterval_upper < 0)
+    return IntervalRational(subinterval_lower, subinterval_upper);
+
+  return std::nullopt;
+}
+
+Rational AlgebraicReal::next_target_width(const Rational &width)
+{
+  return std::min(width / 2, width * width);
+}
+
+IntervalRational AlgebraicReal::refine_to(const Rational &width) const
+{
+  return refine_to(IntervalRational(interval.first, interval.second), width);
+}
+
+IntervalRational AlgebraicReal::refine_to(const IntervalRational &ivr, const Rational &width) const
+{
+  boost::multiprecision::cpp_int subinterval_count = initial_subinterval_count;
+
+  return refine_to(ivr, width, subinterval_count);
+}
+
+IntervalRational AlgebraicReal::refine_to(const IntervalRational &ivr, const Rational &width, boost::multiprecision::cpp_int &subinterval_count) const
+{
+  // Irrational root is never enclosed in a point interval
+  if (width <= 0)
+    throw std::domain_error("Width of interval must be positive");
+
+  if (from_rational)
+    return IntervalRational(r);
+
+  // N is squared on success, and square-rooted on failure (at least initial_subinterval_count)
+  const boost::multiprecision::cpp_int minimum_subinterval_count = initial_subinterval_count;
+
+  IntervalRational refined_ivr = ivr;
+
+  while (refined_ivr.second() - refined_ivr.first() > width)
+  {
+    Budget::charge();
+
+    if (const auto next_ivr = quadratic_refinement_step(refined_ivr, subinterval_count))
+    {
+      refined_ivr = *next_ivr;
+      subinterval_count *= subinterval_count;
+    }
+    else
+    {
+      refined_ivr = next_interval_with_sign(refined_ivr);
+      subinterval_count = std::max(boost::multiprecision::cpp_int(boost::multiprecision::sqrt(subinterval_count)), minimum_subinterval_count);
+    }
+  }
+
+  return refined_ivr;
+}
+
 // move to AlgebraicReal
-std::vector<AlgebraicReal> AlgebraicReal::real_roots(const UnivariatePolynomial<Rational> &p)
+std::vector<AlgebraicReal> AlgebraicReal::real_roots(const UnivariatePolynomial<Rational> &p, const IsolationStrategy strategy)
 {
   using namespace alias::extended::rational;
 
-  return real_roots_between(p, -oo, +oo);
+  return real_roots_between(p, -oo, +oo, strategy);
+}
+
+std::vector<AlgebraicReal> AlgebraicReal::real_roots(const UnivariatePolynomial<Rational> &p, const Rational &precision, const IsolationStrategy strategy)
+{
+  if (precision <= 0)
+    throw std::domain_error("Precision must be positive");
+
+  std::vector<AlgebraicReal> roots = real_roots(p, strategy);
+
+  TaskGroup group(TaskPool::shared());
+
+  for (auto &each_root : roots)
+  {
+    if (each_root.from_rational)
+      continue;
+
+    // Refined root shares the Sturm sequence and its integer images with the isolated one
+    group.run([&each_root, &precision]
+              { each_root = AlgebraicReal(each_root.defining_polynomial_sturm_sequence, each_root.refine_to(precision).to_pair()); });
+  }
+
+  group.wait();
+
+  return roots;
 }
 
-std::vector<AlgebraicReal> AlgebraicReal::real_roots_between(const UnivariatePolynomial<Rational> &p, const Extended<Rational> &e1, const Extended<Rational> &e2)
+std::vector<AlgebraicReal> AlgebraicReal::real_roots_between(const UnivariatePolynomial<Rational> &p, const Extended<Rational> &e1, const Extended<Rational> &e2,
+                                                             const IsolationStrategy strategy)
 {
   if (p == 0)
     throw std::domain_error("Zero polynomial doesn't have root");
@@ -529,37 +711,339 @@ std::vector<AlgebraicReal> AlgebraicReal::real_roots_between(const UnivariatePol
 
   //? f' = square_free, seq = negativeP f'...
   const UnivariatePolynomial square_free_polynomial = square_free(p);
-  const Rational bound = square_free_polynomial.root_bound();
-  const Rational finite_lower_bound = e1.clamp(-bound, bound);
-  const Rational finite_upper_bound = e2.clamp(-bound, bound);
-  const SturmSequence sturm_sequence = SturmSequence(square_free_polynomial);
+
+  // Rational roots are taken exactly and divided out, so that isolation never bisects toward them
+  UnivariatePolynomial<boost::multiprecision::cpp_int> integer_irrational_part = IntegerPolynomial::primitive_part(square_free_polynomial);
+  std::vector<AlgebraicReal> rational_roots;
+
+  for (const auto &each_root : Factorization::rational_roots(integer_irrational_part))
+  {
+    // Division by q x - p in integers is much cheaper than in rationals
+    integer_irrational_part = *IntegerPolynomial::exact_quotient(integer_irrational_part, {boost::multiprecision::cpp_int(-each_root.get_numerator()), each_root.get_denominator()});
+
+    if (e1 < each_root && each_root <= e2)
+      rational_roots.push_back(each_root);
+  }
+
+  if (integer_irrational_part.degree() == 0)
+    return rational_roots;
+
+  std::vector<Rational> irrational_part_a(integer_irrational_part.a.size());
+
+  std::transform(integer_irrational_part.a.begin(), integer_irrational_part.a.end(), irrational_part_a.begin(), [](const boost::multiprecision::cpp_int &c)
+                 { return Rational(c, 1); });
+
+  const UnivariatePolynomial<Rational> irrational_part(irrational_part_a);
+
+  const std::vector<AlgebraicReal> irrational_roots = isolate_real_roots(irrational_part, e1, e2, strategy);
+
+  std::vector<AlgebraicReal> roots;
+  roots.reserve(rational_roots.size() + irrational_roots.size());
+
+  std::merge(rational_roots.begin(), rational_roots.end(), irrational_roots.begin(), irrational_roots.end(), std::back_inserter(roots));
+
+  return roots;
+}
+
+std::vector<AlgebraicReal> AlgebraicReal::isolate_real_roots(const UnivariatePolynomial<Rational> &square_free_polynomial, const Extended<Rational> &e1, const Extended<Rational> &e2,
+                                                             const IsolationStrategy strategy)
+{
+  // Clamp each side independently by power-of-two bounds so that midpoints stay dyadic
+  const Rational lower_bound = -RootBound::negative_root_bound(square_free_polynomial);
+  const Rational upper_bound = RootBound::positive_root_bound(square_free_polynomial);
+  const Rational finite_lower_bound = e1.clamp(lower_bound, upper_bound);
+  const Rational finite_upper_bound = e2.clamp(lower_bound, upper_bound);
+
+  if (strategy == IsolationStrategy::Aberth)
+  {
+    const SturmSequence sturm_sequence = SturmSequence<Rational>::from_signed_subresultants(square_free_polynomial);
+
+    // Roots between all separators are counted by one batch of Sturm evaluations
+    const std::vector<Rational> separators = AberthIsolation::separators(IntegerPolynomial::primitive_part(square_free_polynomial), finite_lower_bound, finite_upper_bound);
+    const std::vector<int> sign_changes = sturm_sequence.count_sign_changes_at(separators);
+
+    std::vector<AlgebraicReal> roots;
+
+    for (size_t i = 0; i + 1 < separators.size(); i++)
+    {
+      const std::pair<Rational, Rational> interval = {separators.at(i), separators.at(i + 1)};
+
+      if (sign_changes.at(i) - sign_changes.at(i + 1) == 1)
+      {
+        roots.push_back(AlgebraicReal(sturm_sequence, interval));
+      }
+      else
+      {
+        // Separators missed some roots here, so isolate them by bisection
+        const std::vector<AlgebraicReal> bisected_roots = bisect_roots(sturm_sequence, interval, {sign_changes.at(i), sign_changes.at(i + 1)});
+        roots.insert(roots.end(), bisected_roots.begin(), bisected_roots.end());
+      }
+    }
+
+    return roots;
+  }
+
+  if (strategy != IsolationStrategy::Sturm)
+  {
+    const auto integer_polynomial = IntegerPolynomial::primitive_part(square_free_polynomial);
+
+    std::vector<std::pair<Rational, Rational>> intervals;
+
+    switch (strategy)
+    {
+    case IsolationStrategy::Descartes:
+      intervals = DescartesIsolation::isolate(integer_polynomial, finite_lower_bound, finite_upper_bound);
+      break;
+    case IsolationStrategy::ContinuedFraction:
+      intervals = ContinuedFractionIsolation::isolate(integer_polynomial, finite_lower_bound, finite_upper_bound);
+      break;
+    default:
+      intervals = BitstreamDescartes::isolate(integer_polynomial, finite_lower_bound, finite_upper_bound);
+      break;
+    }
+
+    std::vector<AlgebraicReal> roots;
+    roots.reserve(intervals.size());
+
+    const SturmSequence sturm_sequence = SturmSequence<Rational>::from_signed_subresultants(square_free_polynomial);
+
+    for (const auto &each_interval : intervals)
+    {
+      roots.push_back(AlgebraicReal(sturm_sequence, each_interval));
+    }
+
+    return roots;
+  }
+
+  const SturmSequence sturm_sequence = SturmSequence<Rational>::from_signed_subresultants(square_free_polynomial);
 
   return bisect_roots(sturm_sequence,
                       {finite_lower_bound, finite_upper_bound},
                       {sturm_sequence.count_sign_change_at_extended(e1), sturm_sequence.count_sign_change_at_extended(e2)});
 }
 
+std::vector<std::vector<AlgebraicReal>> AlgebraicReal::real_roots_batch(const std::vector<UnivariatePolynomial<Rational>> &polynomials, const IsolationStrategy strategy)
+{
+  std::vector<std::vector<AlgebraicReal>> roots(polynomials.size());
+
+  real_roots_batch(
+      polynomials, [&roots](const size_t index, const std::vector<AlgebraicReal> &each_roots)
+      { roots.at(index) = each_roots; },
+      strategy);
+
+  return roots;
+}
+
+void AlgebraicReal::real_roots_batch(const std::vector<UnivariatePolynomial<Rational>> &polynomials,
+                                     const std::function<void(const size_t, const std::vector<AlgebraicReal> &)> &callback,
+                                     const IsolationStrategy strategy)
+{
+  // Polynomials with the same primitive integer polynomial up to sign have the same roots
+  std::map<std::vector<boost::multiprecision::cpp_int>, std::vector<size_t>> indices_by_polynomial;
+
+  for (size_t i = 0; i < polynomials.size(); i++)
+  {
+    if (polynomials.at(i) == 0)
+      throw std::domain_error("Zero polynomial doesn't have root");
+
+    auto integer_polynomial = IntegerPolynomial::primitive_part(polynomials.at(i));
+
+    if (integer_polynomial.leading_coefficient() < 0)
+      integer_polynomial *= -1;
+
+    indices_by_polynomial[integer_polynomial.a].push_back(i);
+  }
+
+  std::mutex callback_mutex;
+
+  TaskGroup group(TaskPool::shared());
+
+  for (const auto &[integer_coefficients, indices] : indices_by_polynomial)
+  {
+    group.run([&polynomials, &indices = indices, &callback, &callback_mutex, strategy]
+              {
+                const std::vector<AlgebraicReal> roots = real_roots(polynomials.at(indices.front()), strategy);
+
+                std::lock_guard<std::mutex> lock(callback_mutex);
+
+                for (const size_t each_index : indices)
+                {
+                  callback(each_index, roots);
+                }
+              });
+  }
+
+  group.wait();
+}
+
+std::vector<std::pair<AlgebraicReal, std::vector<size_t>>> AlgebraicReal::merged_real_roots(const std::vector<UnivariatePolynomial<Rational>> &polynomials,
+                                                                                            const IsolationStrategy strategy)
+{
+  for (const auto &p : polynomials)
+  {
+    if (p == 0)
+      throw std::domain_error("Zero polynomial doesn't have root");
+  }
+
+  const std::vector<UnivariatePolynomial<Rational>> basis = coprime_basis(polynomials);
+
+  // Each basis element divides the inputs vanishing at its roots and is coprime to the others
+  std::vector<std::vector<size_t>> vanishing_indices(basis.size());
+  std::vector<std::vector<AlgebraicReal>> basis_roots(basis.size());
+
+  TaskGroup group(TaskPool::shared());
+
+  for (size_t b_i = 0; b_i < basis.size(); b_i++)
+  {
+    group.run([&polynomials, &basis, &vanishing_indices, &basis_roots, b_i, strategy]
+              {
+                for (size_t i = 0; i < polynomials.size(); i++)
+                {
+                  if (polynomials.at(i) % basis.at(b_i) == 0)
+                    vanishing_indices.at(b_i).push_back(i);
+                }
+
+                basis_roots.at(b_i) = real_roots(basis.at(b_i), strategy);
+              });
+  }
+
+  group.wait();
+
+  // Each root with the index of its basis element
+  std::vector<std::pair<AlgebraicReal, size_t>> roots;
+
+  for (size_t b_i = 0; b_i < basis.size(); b_i++)
+  {
+    for (const auto &each_root : basis_roots.at(b_i))
+    {
+      roots.push_back({each_root, b_i});
+    }
+  }
+
+  // Roots are distinct, so refining overlapping intervals eventually separates every adjacent pair
+  while (true)
+  {
+    Budget::charge();
+
+    std::sort(roots.begin(), roots.end(), [](const std::pair<AlgebraicReal, size_t> &a, const std::pair<AlgebraicReal, size_t> &b)
+              { return a.first.interval < b.first.interval; });
+
+    std::vector<bool> is_overlapped(roots.size(), false);
+
+    for (size_t i = 0; i + 1 < roots.size(); i++)
+    {
+      if (is_overlapping(roots.at(i).first.interval, roots.at(i + 1).first.interval))
+        is_overlapped.at(i) = is_overlapped.at(i + 1) = true;
+    }
+
+    if (std::find(is_overlapped.begin(), is_overlapped.end(), true) == is_overlapped.end())
+      break;
+
+    for (size_t i = 0; i < roots.size(); i++)
+    {
+      auto &each_root = roots.at(i).first;
+
+      if (!is_overlapped.at(i) || each_root.from_rational)
+        continue;
+
+      const Rational half_width = (each_root.interval.second - each_root.interval.first) / 2;
+
+      each_root = AlgebraicReal(each_root.defining_polynomial_sturm_sequence, each_root.refine_to(half_width).to_pair());
+    }
+  }
+
+  std::vector<std::pair<AlgebraicReal, std::vector<size_t>>> tagged_roots;
+  tagged_roots.reserve(roots.size());
+
+  for (const auto &[each_root, b_i] : roots)
+  {
+    tagged_roots.push_back({each_root, vanishing_indices.at(b_i)});
+  }
+
+  return tagged_roots;
+}
+
 // each pair is {r, count_of_sign_change}
 std::vector<AlgebraicReal> AlgebraicReal::bisect_roots(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> interval, const std::pair<int, int> interval_sign_change)
 {
   if (interval_sign_change.first <= interval_sign_change.second)
     return {}; // no root between the interval
 
-  if (interval_sign_change.first == interval_sign_change.second + 1)
+  // Each root has its own slot, so the order doesn't depend on scheduling of tasks. Slots are empty until filled,
+  // since a default AlgebraicReal would build a Sturm sequence only to be overwritten.
+  std::vector<std::optional<AlgebraicReal>> root_slots(interval_sign_change.first - interval_sign_change.second);
+
+  TaskGroup group(TaskPool::shared());
+
+  bisect_roots_into(sturm_sequence, interval, interval_sign_change, 0, root_slots.begin(), group);
+  group.wait();
+
+  std::vector<AlgebraicReal> roots;
+  roots.reserve(root_slots.size());
+
+  for (auto &each_slot : root_slots)
   {
-    return {AlgebraicReal(sturm_sequence.first_term(), interval)};
+    roots.push_back(std::move(*each_slot));
   }
 
-  Rational middle = (interval.first + interval.second) / 2;
-  const int middle_sign_change = sturm_sequence.count_sign_change_at(middle);
+  return roots;
+}
 
-  std::vector<AlgebraicReal> first_half_roots = bisect_roots(sturm_sequence, {interval.first, middle}, {interval_sign_change.first, middle_sign_change});
-  const std::vector<AlgebraicReal> last_half_roots = bisect_roots(sturm_sequence, {middle, interval.second}, {middle_sign_change, interval_sign_change.second});
+void AlgebraicReal::bisect_roots_into(const SturmSequence<Rational> &sturm_sequence, const std::pair<Rational, Rational> interval, const std::pair<int, int> interval_sign_change,
+                                      const int depth, const std::vector<std::optional<AlgebraicReal>>::iterator roots, TaskGroup &group)
+{
+  // Explicit stack instead of recursion, so that a deep cluster of roots doesn't overflow the call stack
+  struct Frame
+  {
+    std::pair<Rational, Rational> interval;
+    // Sign changes at both ends. The one at the middle is shared by both halves.
+    std::pair<int, int> interval_sign_change;
+    int depth;
+    std::vector<std::optional<AlgebraicReal>>::iterator roots;
+  };
 
-  // concat results, could be bottle-neck
-  first_half_roots.insert(first_half_roots.end(), last_half_roots.begin(), last_half_roots.end());
+  std::vector<Frame> stack = {{interval, interval_sign_change, depth, roots}};
 
-  return first_half_roots;
+  while (!stack.empty())
+  {
+    Budget::charge();
+
+    Frame frame = std::move(stack.back());
+    stack.pop_back();
+
+    const auto &[first, second] = frame.interval_sign_change;
+
+    if (first <= second)
+      continue; // no root between the interval
+
+    if (first == second + 1)
+    {
+      *frame.roots = AlgebraicReal(sturm_sequence, frame.interval);
+      continue;
+    }
+
+    const Rational middle = (frame.interval.first + frame.interval.second) / 2;
+    // Each midpoint is visited once, so the memo would only add locking and hashing shared by all workers
+    const int middle_sign_change = sturm_sequence.count_sign_change_at(middle);
+
+    // Roots of the last half come after the ones of the first half
+    const Frame first_half = {{frame.interval.first, middle}, {first, middle_sign_change}, frame.depth + 1, frame.roots};
+    const Frame last_half = {{middle, frame.interval.second}, {middle_sign_change, second}, frame.depth + 1, frame.roots + (first - middle_sign_change)};
+
+    const bool is_both_halves_having_root = first > middle_sign_change && middle_sign_change > second;
+
+    if (is_both_halves_having_root && first - second >= parallel_root_count && frame.depth < parallel_depth)
+    {
+      group.run([&sturm_sequence, first_half, &group]
+                { bisect_roots_into(sturm_sequence, first_half.interval, first_half.interval_sign_change, first_half.depth, first_half.roots, group); });
+    }
+    else
+    {
+      stack.push_back(first_half);
+    }
+
+    stack.push_back(last_half);
+  }
 }
 
 int AlgebraicReal::sign() const
@@ -591,7 +1075,8 @@ AlgebraicReal AlgebraicReal::pow(const boost::multiprecision::cpp_int index) con
 
   using namespace alias::monomial::rational::x;
 
-  auto mod = x.pow(index) % defining_polynomial();
+  // Reduce x^index in Q[x] / (defining polynomial) by repeated squaring, so a huge index never makes a dense x^index
+  auto mod = x.pow_mod(index, defining_polynomial());
 
   std::vector<AlgebraicReal> wrapped_mod_coefficient(mod.coefficient().size());
 
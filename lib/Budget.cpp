@@ -0,0 +1,78 @@
+#include <Budget.h>
+
+void CancellationToken::cancel() const
+{
+  *is_cancelled_flag = true;
+}
+
+bool CancellationToken::is_cancelled() const
+{
+  return *is_cancelled_flag;
+}
+
+static const char *reason_message(const BudgetExhausted::Reason reason)
+{
+  switch (reason)
+  {
+  case BudgetExhausted::Reason::Steps:
+    return "Budget exhausted: step limit exceeded";
+  case BudgetExhausted::Reason::Time:
+    return "Budget exhausted: time limit exceeded";
+  default:
+    return "Budget exhausted: cancelled";
+  }
+}
+
+BudgetExhausted::BudgetExhausted(const Reason reason) : std::runtime_error(reason_message(reason)), exhaustion_reason(reason){};
+
+BudgetExhausted::Reason BudgetExhausted::reason() const
+{
+  return exhaustion_reason;
+}
+
+thread_local Budget *Budget::current_budget = nullptr;
+
+Budget::Budget(const std::optional<unsigned long long> max_steps, const std::optional<std::chrono::steady_clock::duration> max_time, const CancellationToken token)
+    : max_steps(max_steps),
+      deadline(max_time ? std::optional(std::chrono::steady_clock::now() + *max_time) : std::nullopt),
+      token(token){};
+
+void Budget::consume(const unsigned long long steps)
+{
+  if (token.is_cancelled())
+    throw BudgetExhausted(BudgetExhausted::Reason::Cancelled);
+
+  const unsigned long long total_steps = used_steps += steps;
+
+  if (max_steps && total_steps > *max_steps)
+    throw BudgetExhausted(BudgetExhausted::Reason::Steps);
+
+  if (deadline && std::chrono::steady_clock::now() > *deadline)
+    throw BudgetExhausted(BudgetExhausted::Reason::Time);
+}
+
+unsigned long long Budget::steps() const
+{
+  return used_steps;
+}
+
+Budget *Budget::current()
+{
+  return current_budget;
+}
+
+void Budget::charge(const unsigned long long steps)
+{
+  if (current_budget)
+    current_budget->consume(steps);
+}
+
+Budget::Scope::Scope(Budget *budget) : previous_budget(current_budget)
+{
+  current_budget = budget;
+}
+
+Budget::Scope::~Scope()
+{
+  current_budget = previous_budget;
+}
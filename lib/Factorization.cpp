@@ -0,0 +1,900 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+
+#include <Budget.h>
+#include <Factorization.h>
+#include <IntegerPolynomial.h>
+
+/*
+*  Polynomial over Z/pZ for prime p < 2^31, so that product of two coefficients fits in 64 bits.
+*  Coefficients are arranged in ascending order of degree without zeros of high degree.
+*/
+typedef std::vector<unsigned long long> ModularPolynomial;
+
+// Polynomial over Z/mZ for modulus m of Hensel lifting, arranged in the same way
+typedef std::vector<boost::multiprecision::cpp_int> LiftedPolynomial;
+
+static int degree(const ModularPolynomial &f)
+{
+  return static_cast<int>(f.size()) - 1;
+}
+
+static ModularPolynomial trimmed(ModularPolynomial f)
+{
+  while (!f.empty() && f.back() == 0)
+  {
+    f.pop_back();
+  }
+
+  return f;
+}
+
+static unsigned long long power_mod(unsigned long long base, unsigned long long exponent, const unsigned long long p)
+{
+  unsigned long long result = 1;
+  base %= p;
+
+  while (exponent > 0)
+  {
+    if (exponent & 1)
+      result = result * base % p;
+
+    base = base * base % p;
+    exponent >>= 1;
+  }
+
+  return result;
+}
+
+static unsigned long long inverse_mod(const unsigned long long a, const unsigned long long p)
+{
+  return power_mod(a, p - 2, p);
+}
+
+static ModularPolynomial subtract(const ModularPolynomial &f, const ModularPolynomial &g, const unsigned long long p)
+{
+  ModularPolynomial difference(std::max(f.size(), g.size()), 0);
+
+  for (size_t i = 0; i < difference.size(); i++)
+  {
+    const unsigned long long f_i = i < f.size() ? f.at(i) : 0, g_i = i < g.size() ? g.at(i) : 0;
+    difference.at(i) = (f_i + p - g_i) % p;
+  }
+
+  return trimmed(difference);
+}
+
+static ModularPolynomial multiply(const ModularPolynomial &f, const ModularPolynomial &g, const unsigned long long p)
+{
+  if (f.empty() || g.empty())
+    return {};
+
+  ModularPolynomial product(f.size() + g.size() - 1, 0);
+
+  for (size_t i = 0; i < f.size(); i++)
+  {
+    for (size_t j = 0; j < g.size(); j++)
+    {
+      product.at(i + j) = (product.at(i + j) + f.at(i) * g.at(j)) % p;
+    }
+  }
+
+  return trimmed(product);
+}
+
+// Quotient and remainder by non-zero divisor
+static std::pair<ModularPolynomial, ModularPolynomial> divide(const ModularPolynomial &f, const ModularPolynomial &g, const unsigned long long p)
+{
+  if (degree(f) < degree(g))
+    return {{}, f};
+
+  ModularPolynomial remainder = f, quotient(f.size() - g.size() + 1, 0);
+
+  const unsigned long long leading_inverse = inverse_mod(g.back(), p);
+
+  for (int i = degree(f) - degree(g); i >= 0; i--)
+  {
+    const unsigned long long coefficient = remainder.at(i + degree(g)) * leading_inverse % p;
+    quotient.at(i) = coefficient;
+
+    for (size_t j = 0; j < g.size(); j++)
+    {
+      remainder.at(i + j) = (remainder.at(i + j) + p - coefficient * g.at(j) % p) % p;
+    }
+  }
+
+  return {trimmed(quotient), trimmed(remainder)};
+}
+
+static ModularPolynomial monic(const ModularPolynomial &f, const unsigned long long p)
+{
+  if (f.empty())
+    return f;
+
+  const unsigned long long leading_inverse = inverse_mod(f.back(), p);
+
+  ModularPolynomial monic_f = f;
+
+  for (auto &each_a : monic_f)
+  {
+    each_a = each_a * leading_inverse % p;
+  }
+
+  return monic_f;
+}
+
+// Monic GCD d with s f + t g = d
+static std::tuple<ModularPolynomial, ModularPolynomial, ModularPolynomial> extended_gcd(const ModularPolynomial &f, const ModularPolynomial &g, const unsigned long long p)
+{
+  ModularPolynomial r_old = f, r = g, s_old = {1}, s = {}, t_old = {}, t = {1};
+
+  while (!r.empty())
+  {
+    const auto [quotient, remainder] = divide(r_old, r, p);
+
+    r_old = std::exchange(r, remainder);
+    s_old = std::exchange(s, subtract(s_old, multiply(quotient, s, p), p));
+    t_old = std::exchange(t, subtract(t_old, multiply(quotient, t, p), p));
+  }
+
+  if (r_old.empty())
+    return {r_old, s_old, t_old};
+
+  const ModularPolynomial leading_inverse = {inverse_mod(r_old.back(), p)};
+
+  return {monic(r_old, p), multiply(s_old, leading_inverse, p), multiply(t_old, leading_inverse, p)};
+}
+
+static ModularPolynomial gcd(const ModularPolynomial &f, const ModularPolynomial &g, const unsigned long long p)
+{
+  return std::get<0>(extended_gcd(f, g, p));
+}
+
+// base^exponent modulo non-constant modulus
+static ModularPolynomial power_mod(const ModularPolynomial &base, boost::multiprecision::cpp_int exponent, const ModularPolynomial &modulus, const unsigned long long p)
+{
+  ModularPolynomial result = {1}, square = divide(base, modulus, p).second;
+
+  while (exponent > 0)
+  {
+    if (exponent & 1)
+      result = divide(multiply(result, square, p), modulus, p).second;
+
+    square = divide(multiply(square, square, p), modulus, p).second;
+    exponent >>= 1;
+  }
+
+  return result;
+}
+
+static ModularPolynomial differential(const ModularPolynomial &f, const unsigned long long p)
+{
+  ModularPolynomial derivative(f.size() > 1 ? f.size() - 1 : 0);
+
+  for (size_t i = 1; i < f.size(); i++)
+  {
+    derivative.at(i - 1) = f.at(i) * (i % p) % p;
+  }
+
+  return trimmed(derivative);
+}
+
+static ModularPolynomial reduce(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const unsigned long long p)
+{
+  ModularPolynomial reduced(f.a.size());
+
+  for (size_t i = 0; i < f.a.size(); i++)
+  {
+    boost::multiprecision::cpp_int residue = f.a.at(i) % p;
+
+    if (residue < 0)
+      residue += p;
+
+    reduced.at(i) = residue.convert_to<unsigned long long>();
+  }
+
+  return trimmed(reduced);
+}
+
+// Split product of distinct monic irreducible factors of degree d by Cantor-Zassenhaus algorithm (p is odd)
+static void split_equal_degree(const ModularPolynomial &g, const int d, const unsigned long long p, std::mt19937_64 &random, std::vector<ModularPolynomial> &factors)
+{
+  if (degree(g) == d)
+  {
+    factors.push_back(g);
+    return;
+  }
+
+  const boost::multiprecision::cpp_int exponent = (boost::multiprecision::pow(boost::multiprecision::cpp_int(p), d) - 1) / 2;
+
+  std::uniform_int_distribution<unsigned long long> coefficient_distribution(0, p - 1);
+
+  while (true)
+  {
+    Budget::charge();
+
+    ModularPolynomial a(degree(g));
+
+    for (auto &each_a : a)
+    {
+      each_a = coefficient_distribution(random);
+    }
+
+    a = trimmed(a);
+
+    if (degree(a) <= 0)
+      continue;
+
+    // Half of the factors divide a^((p^d - 1) / 2) - 1 on average
+    const ModularPolynomial h = gcd(g, subtract(power_mod(a, exponent, g, p), {1}, p), p);
+
+    if (degree(h) > 0 && degree(h) < degree(g))
+    {
+      split_equal_degree(h, d, p, random, factors);
+      split_equal_degree(divide(g, h, p).first, d, p, random, factors);
+      return;
+    }
+  }
+}
+
+// Monic irreducible factors of monic square-free polynomial by distinct-degree factorization and equal-degree splitting
+static std::vector<ModularPolynomial> factor_modular(const ModularPolynomial &f, const unsigned long long p)
+{
+  std::mt19937_64 random(p);
+
+  std::vector<ModularPolynomial> factors;
+
+  ModularPolynomial rest = f;
+  const ModularPolynomial x = {0, 1};
+  // x^(p^d) modulo rest
+  ModularPolynomial frobenius_power = x;
+
+  for (int d = 1; 2 * d <= degree(rest); d++)
+  {
+    Budget::charge();
+
+    frobenius_power = power_mod(frobenius_power, p, rest, p);
+
+    // Product of all irreducible factors of degree d
+    const ModularPolynomial g = gcd(rest, subtract(frobenius_power, x, p), p);
+
+    if (degree(g) > 0)
+    {
+      split_equal_degree(g, d, p, random, factors);
+      rest = divide(rest, g, p).first;
+      frobenius_power = divide(frobenius_power, rest, p).second;
+    }
+  }
+
+  if (degree(rest) > 0)
+    factors.push_back(monic(rest, p));
+
+  return factors;
+}
+
+static bool is_prime(const unsigned long long n)
+{
+  if (n < 2)
+    return false;
+
+  for (unsigned long long d = 2; d * d <= n; d++)
+  {
+    if (n % d == 0)
+      return false;
+  }
+
+  return true;
+}
+
+/*
+*  Number of odd primes not dividing the leading coefficient which may break square-freeness of square-free f.
+*  They divide the discriminant, and |disc(f)| <= n^n ||f||^(2n - 2) by Mahler's bound, so there are at most log_3 of it.
+*/
+static int square_free_failure_bound(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+{
+  boost::multiprecision::cpp_int square_norm = 0;
+
+  for (const auto &c : f.a)
+  {
+    square_norm += c * c;
+  }
+
+  const int n = f.degree();
+  const double log2_norm = (boost::multiprecision::msb(square_norm) + 1) / 2.0;
+
+  return static_cast<int>(std::ceil((n * std::log2(n) + (2 * n - 2) * log2_norm) / std::log2(3.0)));
+}
+
+/*
+*  Prime which keeps degree and square-freeness of f.
+*  Non-square-free f is not square-free modulo any prime, so no prime would be found for it. Each prime breaking
+*  square-freeness uses one of allowed_failures, which starts at square_free_failure_bound(f), and std::domain_error is
+*  thrown when more primes break it than square-free f allows.
+*/
+static bool is_good_prime(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const unsigned long long p, int &allowed_failures)
+{
+  if (!is_prime(p) || f.leading_coefficient() % p == 0)
+    return false;
+
+  const ModularPolynomial reduced = reduce(f, p);
+
+  if (degree(gcd(reduced, differential(reduced, p), p)) == 0)
+    return true;
+
+  if (--allowed_failures < 0)
+    throw std::domain_error("Polynomial is not square-free");
+
+  return false;
+}
+
+// Distinct roots of f in Z/pZ, from the product of linear factors gcd(f, x^p - x)
+static std::vector<unsigned long long> modular_roots(const ModularPolynomial &f, const unsigned long long p)
+{
+  const ModularPolynomial x = {0, 1};
+  const ModularPolynomial linear_factors_product = gcd(f, subtract(power_mod(x, p, f, p), x, p), p);
+
+  if (degree(linear_factors_product) <= 0)
+    return {};
+
+  std::mt19937_64 random(p);
+  std::vector<ModularPolynomial> linear_factors;
+
+  split_equal_degree(linear_factors_product, 1, p, random, linear_factors);
+
+  std::vector<unsigned long long> roots;
+
+  for (const auto &each_factor : linear_factors)
+  {
+    roots.push_back((p - each_factor.front()) % p);
+  }
+
+  return roots;
+}
+
+// ---- Polynomials over Z/mZ for Hensel lifting
+
+static LiftedPolynomial reduce(const LiftedPolynomial &f, const boost::multiprecision::cpp_int &m)
+{
+  LiftedPolynomial reduced = f;
+
+  for (auto &each_a : reduced)
+  {
+    each_a %= m;
+
+    if (each_a < 0)
+      each_a += m;
+  }
+
+  while (!reduced.empty() && reduced.back() == 0)
+  {
+    reduced.pop_back();
+  }
+
+  return reduced;
+}
+
+static LiftedPolynomial add(const LiftedPolynomial &f, const LiftedPolynomial &g, const boost::multiprecision::cpp_int &m)
+{
+  LiftedPolynomial sum(std::max(f.size(), g.size()), 0);
+
+  for (size_t i = 0; i < sum.size(); i++)
+  {
+    sum.at(i) = (i < f.size() ? f.at(i) : 0) + (i < g.size() ? g.at(i) : 0);
+  }
+
+  return reduce(sum, m);
+}
+
+static LiftedPolynomial subtract(const LiftedPolynomial &f, const LiftedPolynomial &g, const boost::multiprecision::cpp_int &m)
+{
+  LiftedPolynomial difference(std::max(f.size(), g.size()), 0);
+
+  for (size_t i = 0; i < difference.size(); i++)
+  {
+    difference.at(i) = (i < f.size() ? f.at(i) : 0) - (i < g.size() ? g.at(i) : 0);
+  }
+
+  return reduce(difference, m);
+}
+
+static LiftedPolynomial multiply(const LiftedPolynomial &f, const LiftedPolynomial &g, const boost::multiprecision::cpp_int &m)
+{
+  if (f.empty() || g.empty())
+    return {};
+
+  LiftedPolynomial product(f.size() + g.size() - 1, 0);
+
+  for (size_t i = 0; i < f.size(); i++)
+  {
+    for (size_t j = 0; j < g.size(); j++)
+    {
+      product.at(i + j) += f.at(i) * g.at(j);
+    }
+  }
+
+  return reduce(product, m);
+}
+
+// Quotient and remainder by monic divisor
+static std::pair<LiftedPolynomial, LiftedPolynomial> divide_by_monic(const LiftedPolynomial &f, const LiftedPolynomial &g, const boost::multiprecision::cpp_int &m)
+{
+  const int f_degree = static_cast<int>(f.size()) - 1, g_degree = static_cast<int>(g.size()) - 1;
+
+  if (f_degree < g_degree)
+    return {{}, f};
+
+  LiftedPolynomial remainder = f, quotient(f_degree - g_degree + 1, 0);
+
+  for (int i = f_degree - g_degree; i >= 0; i--)
+  {
+    const boost::multiprecision::cpp_int coefficient = remainder.at(i + g_degree) % m;
+    quotient.at(i) = coefficient;
+
+    for (int j = 0; j <= g_degree; j++)
+    {
+      remainder.at(i + j) = (remainder.at(i + j) - coefficient * g.at(j)) % m;
+    }
+  }
+
+  return {reduce(quotient, m), reduce(remainder, m)};
+}
+
+static boost::multiprecision::cpp_int inverse_mod(const boost::multiprecision::cpp_int &a, const boost::multiprecision::cpp_int &m)
+{
+  boost::multiprecision::cpp_int r_old = a % m, r = m, s_old = 1, s = 0;
+
+  while (r != 0)
+  {
+    const boost::multiprecision::cpp_int quotient = r_old / r;
+
+    r_old = std::exchange(r, boost::multiprecision::cpp_int(r_old - quotient * r));
+    s_old = std::exchange(s, boost::multiprecision::cpp_int(s_old - quotient * s));
+  }
+
+  return (s_old % m + m) % m;
+}
+
+static LiftedPolynomial lifted(const ModularPolynomial &f)
+{
+  return LiftedPolynomial(f.begin(), f.end());
+}
+
+/*
+*   One step of quadratic Hensel lifting from modulus m to m^2 (Algorithm 15.10 of von zur Gathen and Gerhard, Modern Computer Algebra).
+*   From f = g h and s g + t h = 1 modulo m with monic h, update g, h, s and t so that they hold modulo m^2.
+*/
+static void hensel_step(const LiftedPolynomial &f, LiftedPolynomial &g, LiftedPolynomial &h, LiftedPolynomial &s, LiftedPolynomial &t,
+                        const boost::multiprecision::cpp_int &squared_modulus)
+{
+  const LiftedPolynomial e = subtract(f, multiply(g, h, squared_modulus), squared_modulus);
+  const auto [q, r] = divide_by_monic(multiply(s, e, squared_modulus), h, squared_modulus);
+
+  g = add(g, add(multiply(t, e, squared_modulus), multiply(q, g, squared_modulus), squared_modulus), squared_modulus);
+  h = add(h, r, squared_modulus);
+
+  const LiftedPolynomial b = subtract(add(multiply(s, g, squared_modulus), multiply(t, h, squared_modulus), squared_modulus), {1}, squared_modulus);
+  const auto [c, d] = divide_by_monic(multiply(s, b, squared_modulus), h, squared_modulus);
+
+  s = subtract(s, d, squared_modulus);
+  t = subtract(t, add(multiply(t, b, squared_modulus), multiply(c, g, squared_modulus), squared_modulus), squared_modulus);
+}
+
+/*
+*   Lift monic modular factors of f (f = lc(f) * factors modulo p) to monic factors modulo p^(2^j) which exceeds bound.
+*   The first factor is split off with the rest at each round, and the rest is split next.
+*/
+static std::vector<LiftedPolynomial> hensel_lift(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const std::vector<ModularPolynomial> &factors,
+                                                 const unsigned long long p, const boost::multiprecision::cpp_int &bound, boost::multiprecision::cpp_int &modulus)
+{
+  modulus = p;
+
+  while (modulus <= bound)
+  {
+    modulus *= modulus;
+  }
+
+  std::vector<LiftedPolynomial> lifted_factors;
+
+  LiftedPolynomial rest = reduce(LiftedPolynomial(f.a.begin(), f.a.end()), modulus);
+
+  for (size_t i = 0; i + 1 < factors.size(); i++)
+  {
+    const unsigned long long leading_residue = (rest.back() % p).convert_to<unsigned long long>();
+
+    ModularPolynomial rest_factors_product = {1};
+
+    for (size_t j = i + 1; j < factors.size(); j++)
+    {
+      rest_factors_product = multiply(rest_factors_product, factors.at(j), p);
+    }
+
+    const ModularPolynomial g_modular = multiply(factors.at(i), {leading_residue}, p);
+    const auto [one, s_modular, t_modular] = extended_gcd(g_modular, rest_factors_product, p);
+
+    LiftedPolynomial g = lifted(g_modular), h = lifted(rest_factors_product), s = lifted(s_modular), t = lifted(t_modular);
+
+    for (boost::multiprecision::cpp_int m = p; m < modulus; m *= m)
+    {
+      Budget::charge();
+
+      hensel_step(reduce(rest, m * m), g, h, s, t, m * m);
+    }
+
+    // g has the leading coefficient of rest, so make it monic
+    const boost::multiprecision::cpp_int leading_inverse = inverse_mod(g.back(), modulus);
+
+    lifted_factors.push_back(multiply(g, {leading_inverse}, modulus));
+    rest = h;
+  }
+
+  lifted_factors.push_back(multiply(rest, {inverse_mod(rest.back(), modulus)}, modulus));
+
+  return lifted_factors;
+}
+
+// f(x) modulo m by Horner's rule
+static boost::multiprecision::cpp_int value_mod(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f, const boost::multiprecision::cpp_int &x,
+                                                const boost::multiprecision::cpp_int &m)
+{
+  boost::multiprecision::cpp_int value = 0;
+
+  for (auto each_a = f.a.rbegin(); each_a != f.a.rend(); each_a++)
+  {
+    value = (value * x + *each_a) % m;
+  }
+
+  return value < 0 ? boost::multiprecision::cpp_int(value + m) : value;
+}
+
+// Primitive integer polynomial with positive leading coefficient from coefficients symmetric modulo m
+static UnivariatePolynomial<boost::multiprecision::cpp_int> symmetric_primitive_part(const LiftedPolynomial &f, const boost::multiprecision::cpp_int &m)
+{
+  std::vector<boost::multiprecision::cpp_int> symmetric_a = f;
+  boost::multiprecision::cpp_int content = 0;
+
+  for (auto &each_a : symmetric_a)
+  {
+    if (each_a > m / 2)
+      each_a -= m;
+
+    content = boost::multiprecision::gcd(content, each_a);
+  }
+
+  if (symmetric_a.back() < 0)
+    content = -content;
+
+  for (auto &each_a : symmetric_a)
+  {
+    each_a /= content;
+  }
+
+  return UnivariatePolynomial<boost::multiprecision::cpp_int>(symmetric_a);
+}
+
+// Number of primes tried to find the one with the least modular factors
+static constexpr int prime_trial_count = 3;
+
+std::vector<std::pair<UnivariatePolynomial<Rational>, int>> Factorization::square_free_decomposition(const UnivariatePolynomial<Rational> &f)
+{
+  if (f == 0)
+    throw std::domain_error("Zero polynomial doesn't have factorization");
+
+  std::vector<std::pair<UnivariatePolynomial<Rational>, int>> decomposition;
+
+  if (f.degree() == 0)
+    return decomposition;
+
+  const UnivariatePolynomial<Rational> b = gcd(f, f.differential());
+
+  UnivariatePolynomial<Rational> c = f / b, d = f.differential() / b - c.differential();
+
+  for (int multiplicity = 1; c.degree() > 0; multiplicity++)
+  {
+    Budget::charge();
+
+    const UnivariatePolynomial<Rational> a = gcd(c, d).to_monic();
+
+    if (a.degree() > 0)
+      decomposition.push_back({a, multiplicity});
+
+    c = c / a;
+    d = d / a - c.differential();
+  }
+
+  return decomposition;
+}
+
+std::vector<UnivariatePolynomial<boost::multiprecision::cpp_int>> Factorization::square_free_factors(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+{
+  if (f == 0)
+    throw std::domain_error("Zero polynomial doesn't have factorization");
+
+  if (f.degree() <= 0)
+    return {};
+
+  UnivariatePolynomial<boost::multiprecision::cpp_int> rest = symmetric_primitive_part(f.a, 0);
+
+  if (rest.degree() == 1)
+    return {rest};
+
+  // Prime which keeps degree and square-freeness, with the least modular factors
+  unsigned long long p = 0;
+  std::vector<ModularPolynomial> modular_factors;
+
+  int good_prime_count = 0;
+  int allowed_failures = square_free_failure_bound(rest);
+
+  for (unsigned long long candidate = 3; good_prime_count < prime_trial_count; candidate += 2)
+  {
+    if (!is_good_prime(rest, candidate, allowed_failures))
+      continue;
+
+    const ModularPolynomial reduced = reduce(rest, candidate);
+
+    good_prime_count++;
+
+    auto candidate_factors = factor_modular(monic(reduced, candidate), candidate);
+
+    if (p == 0 || candidate_factors.size() < modular_factors.size())
+    {
+      p = candidate;
+      modular_factors = std::move(candidate_factors);
+    }
+  }
+
+  if (modular_factors.size() == 1)
+    return {rest};
+
+  // Mignotte bound: coefficients of factor of f are at most 2^n ||f||_2, and lc(f) times the factor is recombined
+  boost::multiprecision::cpp_int square_norm = 0;
+
+  for (const auto &each_a : rest.a)
+  {
+    square_norm += each_a * each_a;
+  }
+
+  const boost::multiprecision::cpp_int bound = 2 * abs(rest.leading_coefficient()) * (boost::multiprecision::cpp_int(1) << rest.degree()) * (boost::multiprecision::sqrt(square_norm) + 1);
+
+  boost::multiprecision::cpp_int modulus;
+  std::vector<LiftedPolynomial> lifted_factors = hensel_lift(rest, modular_factors, p, bound, modulus);
+
+  // Recombination of subsets, from the smallest size
+  std::vector<UnivariatePolynomial<boost::multiprecision::cpp_int>> factors;
+
+  for (size_t subset_size = 1; 2 * subset_size <= lifted_factors.size();)
+  {
+    std::vector<size_t> indices(subset_size);
+
+    for (size_t i = 0; i < subset_size; i++)
+    {
+      indices.at(i) = i;
+    }
+
+    bool is_found = false;
+
+    while (true)
+    {
+      Budget::charge();
+
+      LiftedPolynomial product = {abs(rest.leading_coefficient()) % modulus};
+
+      for (const size_t each_index : indices)
+      {
+        product = multiply(product, lifted_factors.at(each_index), modulus);
+      }
+
+      const auto candidate = symmetric_primitive_part(product, modulus);
+
+      if (const auto quotient = IntegerPolynomial::exact_quotient(rest, candidate))
+      {
+        factors.push_back(candidate);
+        rest = *quotient;
+
+        for (auto index = indices.rbegin(); index != indices.rend(); index++)
+        {
+          lifted_factors.erase(lifted_factors.begin() + *index);
+        }
+
+        is_found = true;
+        break;
+      }
+
+      // Next subset in lexicographic order
+      int position = subset_size - 1;
+
+      while (position >= 0 && indices.at(position) == lifted_factors.size() - subset_size + position)
+      {
+        position--;
+      }
+
+      if (position < 0)
+        break;
+
+      indices.at(position)++;
+
+      for (size_t i = position + 1; i < subset_size; i++)
+      {
+        indices.at(i) = indices.at(i - 1) + 1;
+      }
+    }
+
+    if (!is_found)
+      subset_size++;
+  }
+
+  if (rest.degree() > 0)
+    factors.push_back(symmetric_primitive_part(rest.a, 0));
+
+  std::sort(factors.begin(), factors.end(), [](const UnivariatePolynomial<boost::multiprecision::cpp_int> &a, const UnivariatePolynomial<boost::multiprecision::cpp_int> &b)
+            { return std::make_pair(a.degree(), a.a) < std::make_pair(b.degree(), b.a); });
+
+  return factors;
+}
+
+std::vector<std::pair<UnivariatePolynomial<boost::multiprecision::cpp_int>, int>> Factorization::factor(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+{
+  std::vector<Rational> rational_a(f.a.size());
+
+  std::transform(f.a.begin(), f.a.end(), rational_a.begin(), [](const boost::multiprecision::cpp_int &c)
+                 { return Rational(c, 1); });
+
+  std::vector<std::pair<UnivariatePolynomial<boost::multiprecision::cpp_int>, int>> factors;
+
+  for (const auto &[square_free_part, multiplicity] : square_free_decomposition(UnivariatePolynomial<Rational>(rational_a)))
+  {
+    for (const auto &each_factor : square_free_factors(IntegerPolynomial::primitive_part(square_free_part)))
+    {
+      factors.push_back({each_factor, multiplicity});
+    }
+  }
+
+  return factors;
+}
+
+std::vector<std::pair<UnivariatePolynomial<Rational>, int>> Factorization::factor(const UnivariatePolynomial<Rational> &f)
+{
+  std::vector<std::pair<UnivariatePolynomial<Rational>, int>> factors;
+
+  for (const auto &[square_free_part, multiplicity] : square_free_decomposition(f))
+  {
+    for (const auto &each_factor : square_free_factors(IntegerPolynomial::primitive_part(square_free_part)))
+    {
+      std::vector<Rational> rational_a(each_factor.a.size());
+
+      std::transform(each_factor.a.begin(), each_factor.a.end(), rational_a.begin(), [](const boost::multiprecision::cpp_int &c)
+                     { return Rational(c, 1); });
+
+      factors.push_back({UnivariatePolynomial<Rational>(rational_a).to_monic(), multiplicity});
+    }
+  }
+
+  return factors;
+}
+
+std::vector<Rational> Factorization::rational_roots(const UnivariatePolynomial<boost::multiprecision::cpp_int> &f)
+{
+  if (f == 0)
+    throw std::domain_error("Zero polynomial doesn't have root");
+
+  std::vector<Rational> roots;
+
+  if (f.degree() <= 0)
+    return roots;
+
+  UnivariatePolynomial<boost::multiprecision::cpp_int> rest = f;
+
+  if (rest.a.front() == 0)
+  {
+    roots.push_back(0);
+    rest = UnivariatePolynomial<boost::multiprecision::cpp_int>(std::vector<boost::multiprecision::cpp_int>(rest.a.begin() + 1, rest.a.end()));
+
+    // Other multiple roots are found by the prime search below
+    if (rest.a.front() == 0)
+      throw std::domain_error("Polynomial is not square-free");
+  }
+
+  if (rest.degree() == 1)
+    roots.push_back(Rational(-rest.a.at(0), rest.a.at(1)));
+
+  // Quadratic a x^2 + b x + c has rational roots exactly when b^2 - 4 a c is a square, which needs no prime search
+  if (rest.degree() == 2)
+  {
+    const boost::multiprecision::cpp_int discriminant = rest.a.at(1) * rest.a.at(1) - 4 * rest.a.at(2) * rest.a.at(0);
+
+    if (discriminant == 0)
+      throw std::domain_error("Polynomial is not square-free");
+
+    if (discriminant > 0)
+    {
+      const boost::multiprecision::cpp_int root = boost::multiprecision::sqrt(discriminant);
+
+      if (root * root == discriminant)
+      {
+        roots.push_back(Rational(boost::multiprecision::cpp_int(-rest.a.at(1) - root), boost::multiprecision::cpp_int(2 * rest.a.at(2))));
+        roots.push_back(Rational(boost::multiprecision::cpp_int(-rest.a.at(1) + root), boost::multiprecision::cpp_int(2 * rest.a.at(2))));
+      }
+    }
+  }
+
+  if (rest.degree() <= 2)
+  {
+    std::sort(roots.begin(), roots.end());
+    return roots;
+  }
+
+  // Screening by modular roots: each rational root is lifted from a root modulo p, so take the prime with the least of them
+  unsigned long long p = 0;
+  std::vector<unsigned long long> candidate_roots;
+
+  int good_prime_count = 0;
+  int allowed_failures = square_free_failure_bound(rest);
+
+  for (unsigned long long candidate = 3; good_prime_count < prime_trial_count && (p == 0 || !candidate_roots.empty()); candidate += 2)
+  {
+    if (!is_good_prime(rest, candidate, allowed_failures))
+      continue;
+
+    good_prime_count++;
+
+    auto roots_modulo_candidate = modular_roots(reduce(rest, candidate), candidate);
+
+    if (p == 0 || roots_modulo_candidate.size() < candidate_roots.size())
+    {
+      p = candidate;
+      candidate_roots = std::move(roots_modulo_candidate);
+    }
+  }
+
+  // Rational root a / b has b | lc(f), and lc(f) a / b is an integer of absolute value at most |lc(f)| + max |a_i| by Cauchy's bound
+  boost::multiprecision::cpp_int maximum_coefficient = 0;
+
+  for (const auto &each_a : rest.a)
+  {
+    maximum_coefficient = std::max(maximum_coefficient, boost::multiprecision::cpp_int(abs(each_a)));
+  }
+
+  const boost::multiprecision::cpp_int bound = 2 * (abs(rest.leading_coefficient()) + maximum_coefficient);
+
+  boost::multiprecision::cpp_int modulus = p;
+
+  while (modulus <= bound)
+  {
+    modulus *= modulus;
+  }
+
+  const UnivariatePolynomial<boost::multiprecision::cpp_int> derivative = rest.differential();
+
+  for (const unsigned long long each_root : candidate_roots)
+  {
+    // Newton's iteration in p-adic numbers doubles correct digits, as f'(root) is a unit for square-free f modulo p
+    boost::multiprecision::cpp_int lifted_root = each_root;
+
+    for (boost::multiprecision::cpp_int m = p; m < modulus; m *= m)
+    {
+      Budget::charge();
+
+      const boost::multiprecision::cpp_int squared_modulus = m * m;
+
+      lifted_root = (lifted_root - value_mod(rest, lifted_root, squared_modulus) * inverse_mod(value_mod(derivative, lifted_root, squared_modulus), squared_modulus)) % squared_modulus;
+    }
+
+    boost::multiprecision::cpp_int numerator = (rest.leading_coefficient() * lifted_root) % modulus;
+
+    if (numerator < 0)
+      numerator += modulus;
+
+    if (numerator > modulus / 2)
+      numerator -= modulus;
+
+    const Rational candidate(numerator, rest.leading_coefficient());
+
+    if (IntegerPolynomial::sign_at(rest, candidate) == 0)
+      roots.push_back(candidate);
+  }
+
+  std::sort(roots.begin(), roots.end());
+
+  return roots;
+}
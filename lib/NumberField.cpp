@@ -0,0 +1,286 @@
+#include <stdexcept>
+
+#include <AliasMonomial.h>
+#include <Budget.h>
+#include <Factorization.h>
+#include <IntervalRational.h>
+#include <NumberField.h>
+#include <SturmSequence.h>
+#include <SylvesterMatrix.h>
+
+// Range of p over ivr by Horner's rule in interval arithmetic
+static IntervalRational evaluate_on(const UnivariatePolynomial<Rational> &p, const IntervalRational &ivr)
+{
+  IntervalRational value = 0;
+
+  for (auto each_a = p.a.rbegin(); each_a != p.a.rend(); each_a++)
+  {
+    value = value * ivr + IntervalRational(*each_a);
+  }
+
+  return value;
+}
+
+NumberField::NumberField(const AlgebraicReal &alpha)
+{
+  using namespace alias::monomial::rational::x;
+
+  if (alpha.get_from_rational())
+  {
+    generator = std::make_shared<const Generator>(Generator{x - alpha.rational(), alpha});
+    return;
+  }
+
+  const auto interval = alpha.get_interval();
+
+  // Exactly one irreducible factor has a root in the isolating interval of alpha
+  for (const auto &[factor, multiplicity] : Factorization::factor(alpha.defining_polynomial()))
+  {
+    if (SturmSequence<Rational>(factor).count_real_roots_between(interval.first, interval.second) == 1)
+    {
+      generator = std::make_shared<const Generator>(Generator{factor, AlgebraicReal(factor, interval)});
+      return;
+    }
+  }
+
+  throw std::domain_error("No factor of defining polynomial vanishes at the number");
+}
+
+const UnivariatePolynomial<Rational> &NumberField::minimal_polynomial() const
+{
+  return generator->minimal_polynomial;
+}
+
+const AlgebraicReal &NumberField::primitive_element() const
+{
+  return generator->alpha;
+}
+
+int NumberField::degree() const
+{
+  return generator->minimal_polynomial.degree();
+}
+
+FieldElement NumberField::alpha() const
+{
+  using namespace alias::monomial::rational::x;
+
+  return FieldElement(*this, x);
+}
+
+FieldElement NumberField::element(const UnivariatePolynomial<Rational> &p) const
+{
+  return FieldElement(*this, p);
+}
+
+bool operator==(const NumberField &f1, const NumberField &f2)
+{
+  if (f1.generator == f2.generator)
+    return true;
+
+  return f1.minimal_polynomial() == f2.minimal_polynomial() && f1.primitive_element() == f2.primitive_element();
+}
+
+bool operator!=(const NumberField &f1, const NumberField &f2)
+{
+  return !(f1 == f2);
+}
+
+void FieldElement::check_same_field(const FieldElement &e) const
+{
+  if (number_field != e.number_field)
+    throw std::domain_error("Elements of different number fields");
+}
+
+FieldElement::FieldElement(const NumberField &number_field, const UnivariatePolynomial<Rational> &p)
+    : number_field(number_field), representative(p % number_field.minimal_polynomial()){};
+
+FieldElement::FieldElement(const NumberField &number_field, const int n)
+    : number_field(number_field), representative(Rational(n)){};
+
+FieldElement::FieldElement(const NumberField &number_field, const Rational &r)
+    : number_field(number_field), representative(r){};
+
+const NumberField &FieldElement::field() const
+{
+  return number_field;
+}
+
+const UnivariatePolynomial<Rational> &FieldElement::polynomial() const
+{
+  return representative;
+}
+
+FieldElement FieldElement::operator+() const
+{
+  return *this;
+}
+
+FieldElement FieldElement::operator-() const
+{
+  return FieldElement(number_field, -representative);
+}
+
+FieldElement &FieldElement::operator+=(const FieldElement &e)
+{
+  check_same_field(e);
+
+  representative += e.representative;
+
+  return *this;
+}
+
+FieldElement &FieldElement::operator-=(const FieldElement &e)
+{
+  check_same_field(e);
+
+  representative -= e.representative;
+
+  return *this;
+}
+
+FieldElement &FieldElement::operator*=(const FieldElement &e)
+{
+  check_same_field(e);
+
+  representative = representative * e.representative % number_field.minimal_polynomial();
+
+  return *this;
+}
+
+FieldElement &FieldElement::operator/=(const FieldElement &e)
+{
+  check_same_field(e);
+
+  return *this *= e.inverse();
+}
+
+bool operator==(const FieldElement &e1, const FieldElement &e2)
+{
+  // Representative is unique since the minimal polynomial is irreducible
+  return e1.number_field == e2.number_field && e1.representative == e2.representative;
+}
+
+std::ostream &operator<<(std::ostream &os, const FieldElement &e)
+{
+  return os << "FieldElement " << e.representative << " | " << e.number_field.primitive_element();
+}
+
+bool FieldElement::is_rational() const
+{
+  return representative.degree() <= 0;
+}
+
+FieldElement FieldElement::inverse() const
+{
+  if (representative == 0)
+    throw std::domain_error("Zero division error");
+
+  // Remainder sequence of m and r with cofactors t of r: r_i = t_i r modulo m
+  UnivariatePolynomial<Rational> previous_remainder = number_field.minimal_polynomial(), remainder = representative;
+  UnivariatePolynomial<Rational> previous_cofactor = 0, cofactor = 1;
+
+  while (remainder.degree() > 0)
+  {
+    Budget::charge();
+
+    const auto [quotient, next_remainder] = previous_remainder.euclidean_division(remainder);
+
+    previous_remainder = std::exchange(remainder, next_remainder);
+    previous_cofactor = std::exchange(cofactor, previous_cofactor - quotient * cofactor);
+  }
+
+  // Irreducible m and non-zero r are coprime, so the last remainder is a non-zero constant
+  if (remainder == 0)
+    throw std::domain_error("Element is not invertible");
+
+  return FieldElement(number_field, cofactor * UnivariatePolynomial<Rational>(1 / remainder.leading_coefficient()));
+}
+
+FieldElement FieldElement::pow(const boost::multiprecision::cpp_int index) const
+{
+  if (index < 0)
+    return inverse().pow(-index);
+
+  return FieldElement(number_field, representative.pow_mod(index, number_field.minimal_polynomial()));
+}
+
+int FieldElement::sign() const
+{
+  if (is_rational())
+    return representative.value_at(0).sign();
+
+  const AlgebraicReal &alpha = number_field.primitive_element();
+
+  IntervalRational alpha_ivr(alpha.get_interval().first, alpha.get_interval().second);
+  Rational width = alpha_ivr.second() - alpha_ivr.first();
+  boost::multiprecision::cpp_int subinterval_count = AlgebraicReal::initial_subinterval_count;
+
+  // r(alpha) is not zero since r is not constant, so the range excludes zero on small enough intervals
+  while (true)
+  {
+    const IntervalRational value_ivr = evaluate_on(representative, alpha_ivr);
+
+    if (value_ivr.first() > 0)
+      return 1;
+
+    if (value_ivr.second() < 0)
+      return -1;
+
+    Budget::charge();
+
+    width /= 2;
+    alpha_ivr = alpha.refine_to(alpha_ivr, width, subinterval_count);
+  }
+}
+
+AlgebraicReal FieldElement::to_algebraic_real() const
+{
+  if (is_rational())
+    return representative.value_at(0);
+
+  typedef UnivariatePolynomial<Rational> RX;
+
+  const AlgebraicReal &alpha = number_field.primitive_element();
+  const RX &minimal_polynomial = number_field.minimal_polynomial();
+
+  // m(y) and x - r(y) as polynomials in y over Q[x]
+  std::vector<RX> nested_minimal_polynomial_coefficient(minimal_polynomial.coefficient().size());
+
+  for (size_t i = 0; i < minimal_polynomial.coefficient().size(); i++)
+  {
+    nested_minimal_polynomial_coefficient.at(i) = RX(minimal_polynomial.coefficient().at(i));
+  }
+
+  std::vector<RX> nested_difference_coefficient(representative.coefficient().size());
+
+  for (size_t i = 0; i < representative.coefficient().size(); i++)
+  {
+    nested_difference_coefficient.at(i) = RX(-representative.coefficient().at(i));
+  }
+
+  nested_difference_coefficient.at(0) += RX({0, 1});
+
+  const RX defining_polynomial = square_free(SylvesterMatrix::resultant(UnivariatePolynomial<RX>(nested_minimal_polynomial_coefficient),
+                                                                        UnivariatePolynomial<RX>(nested_difference_coefficient))
+                                                 .to_monic())
+                                     .to_monic();
+
+  const SturmSequence sturm_sequence(defining_polynomial);
+
+  IntervalRational alpha_ivr(alpha.get_interval().first, alpha.get_interval().second);
+  IntervalRational value_ivr = evaluate_on(representative, alpha_ivr);
+  Rational width = alpha_ivr.second() - alpha_ivr.first();
+  boost::multiprecision::cpp_int subinterval_count = AlgebraicReal::initial_subinterval_count;
+
+  while (sturm_sequence.count_real_roots_between(value_ivr.first(), value_ivr.second()) >= 2)
+  {
+    Budget::charge();
+
+    width /= 2;
+    alpha_ivr = alpha.refine_to(alpha_ivr, width, subinterval_count);
+    value_ivr = evaluate_on(representative, alpha_ivr);
+  }
+
+  return AlgebraicReal(sturm_sequence, value_ivr.to_pair());
+}
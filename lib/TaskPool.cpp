@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <utility>
+
+#include <Budget.h>
+#include <TaskPool.h>
+
+thread_local const TaskPool *TaskPool::current_pool = nullptr;
+thread_local int TaskPool::current_worker = -1;
+
+TaskPool::TaskPool(const unsigned worker_count)
+{
+  const unsigned queue_count = std::max(worker_count, 1u);
+
+  for (unsigned i = 0; i < queue_count; i++)
+  {
+    queues.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  for (unsigned i = 0; i < worker_count; i++)
+  {
+    workers.emplace_back(&TaskPool::work, this, i);
+  }
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    is_stopping = true;
+  }
+  sleep_condition.notify_all();
+
+  for (auto &each_worker : workers)
+  {
+    each_worker.join();
+  }
+}
+
+TaskPool &TaskPool::shared()
+{
+  static TaskPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+
+  return pool;
+}
+
+unsigned TaskPool::size() const
+{
+  return workers.size();
+}
+
+void TaskPool::submit(std::function<void()> task)
+{
+  const size_t index = current_pool == this ? current_worker : next_queue++ % queues.size();
+
+  {
+    std::lock_guard<std::mutex> lock(queues.at(index)->mutex);
+    queues.at(index)->tasks.push_back(std::move(task));
+  }
+
+  {
+    // Lock so that a worker going to sleep does not miss the notification
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    queued_count++;
+  }
+  sleep_condition.notify_one();
+}
+
+bool TaskPool::run_one(const int home)
+{
+  std::function<void()> task;
+
+  for (size_t i = 0; i < queues.size() && !task; i++)
+  {
+    const bool is_own = home >= 0 && i == 0;
+    WorkerQueue &queue = *queues.at(home >= 0 ? (home + i) % queues.size() : i);
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty())
+      continue;
+
+    if (is_own)
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+    else
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+  }
+
+  if (!task)
+    return false;
+
+  queued_count--;
+  task();
+
+  return true;
+}
+
+void TaskPool::work(const int index)
+{
+  current_pool = this;
+  current_worker = index;
+
+  while (true)
+  {
+    if (run_one(index))
+      continue;
+
+    // submit() counts the task under sleep_mutex before notifying, so no task is missed
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_condition.wait(lock, [this]
+                         { return is_stopping || queued_count > 0; });
+
+    if (is_stopping)
+      return;
+  }
+}
+
+void TaskPool::help_until(const std::function<bool()> &is_done)
+{
+  const int home = current_pool == this ? current_worker : -1;
+
+  while (!is_done())
+  {
+    if (run_one(home))
+      continue;
+
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_condition.wait(lock, [this, &is_done]
+                         { return queued_count > 0 || is_done(); });
+  }
+
+  // Notification of a submitted task may have woken this thread instead of a worker, so pass it on
+  if (queued_count > 0)
+    sleep_condition.notify_one();
+}
+
+void TaskPool::notify_done()
+{
+  {
+    // Lock so that a thread between checking is_done and sleeping does not miss the notification
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+  }
+  sleep_condition.notify_all();
+}
+
+TaskGroup::~TaskGroup()
+{
+  // Tasks refer to this group, so they must finish even when wait() was skipped by an exception
+  pool.help_until([this]
+                  { return pending_count == 0; });
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+  pending_count++;
+
+  pool.submit([this, &task_pool = pool, task = std::move(task), budget = Budget::current()]
+              {
+                try
+                {
+                  // Task runs under the budget of the thread which submitted it
+                  Budget::Scope scope(budget);
+
+                  task();
+                }
+                catch (...)
+                {
+                  std::lock_guard<std::mutex> lock(error_mutex);
+                  if (!error)
+                    error = std::current_exception();
+                }
+
+                // Group may be destroyed once the count reaches zero, so only the pool is touched after it
+                if (--pending_count == 0)
+                  task_pool.notify_done();
+              });
+}
+
+void TaskGroup::wait()
+{
+  pool.help_until([this]
+                  { return pending_count == 0; });
+
+  std::lock_guard<std::mutex> lock(error_mutex);
+
+  if (error)
+    std::rethrow_exception(std::exchange(error, nullptr));
+}
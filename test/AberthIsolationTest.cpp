@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <AberthIsolation.h>
+#include <AliasMonomial.h>
+
+/*
+  Test module for AberthIsolation.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(AberthIsolationTest, ApproximateRoots)
+{
+  using namespace alias::monomial::integer::x;
+
+  // roots are 1, -2, i and -i
+  auto roots = AberthIsolation::approximate_roots((x - 1) * (x + 2) * (x2 + 1));
+
+  ASSERT_EQ(roots.size(), 4);
+
+  for (const std::complex<double> expected_root : {std::complex<double>(1, 0), std::complex<double>(-2, 0), std::complex<double>(0, 1), std::complex<double>(0, -1)})
+  {
+    EXPECT_EQ(std::count_if(roots.begin(), roots.end(), [&expected_root](const std::complex<double> &z)
+                            { return std::abs(z - expected_root) < 1e-10; }),
+              1);
+  }
+
+  EXPECT_TRUE(AberthIsolation::approximate_roots(UnivariatePolynomial<boost::multiprecision::cpp_int>(3)).empty());
+}
+
+TEST(AberthIsolationTest, Separators)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  // roots are -3, -sqrt(2), sqrt(2) and 5
+  const auto separators = AberthIsolation::separators((x + 3) * (x2 - 2) * (x - 5) * (x2 + 4), -8, 8);
+
+  ASSERT_EQ(separators.size(), 5);
+
+  EXPECT_EQ(separators.front(), -8);
+  EXPECT_EQ(separators.back(), 8);
+
+  EXPECT_LT(Q(-3), separators.at(1));
+  EXPECT_LT(separators.at(1), Q(-7, 5));
+  EXPECT_EQ(separators.at(2), 0);
+  EXPECT_LT(Q(3, 2), separators.at(3));
+  EXPECT_LT(separators.at(3), Q(5));
+
+  // Separators are only inside of the interval: the one between sqrt(2) and 5 is kept and the others are dropped
+  const auto inner_separators = AberthIsolation::separators((x + 3) * (x2 - 2) * (x - 5), 0, 4);
+
+  ASSERT_EQ(inner_separators.size(), 3);
+  EXPECT_EQ(inner_separators.front(), 0);
+  EXPECT_LT(Q(3, 2), inner_separators.at(1));
+  EXPECT_LT(inner_separators.at(1), Q(4));
+  EXPECT_EQ(inner_separators.back(), 4);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <AlgebraicExpr.h>
+#include <AlgebraicReal.h>
+#include <AliasMonomial.h>
+
+/*
+  Test module for AlgebraicExpr.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(AlgebraicExprTest, Constructor)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  EXPECT_EQ(AlgebraicExpr().sign(), 0);
+  EXPECT_EQ(AlgebraicExpr(-3).sign(), -1);
+  EXPECT_EQ(AlgebraicExpr(Q(1, 3)).materialize(), Q(1, 3));
+  EXPECT_EQ(AlgebraicExpr(AlgebraicReal(x2 - 2, {1, 2})).materialize(), AlgebraicReal(x2 - 2, {1, 2}));
+}
+
+TEST(AlgebraicExprTest, Evaluate)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const AlgebraicExpr sqrt2 = AlgebraicReal(x2 - 2, {1, 2});
+  const auto ivr = (sqrt2 * sqrt2 + 1).evaluate(64);
+
+  ASSERT_TRUE(ivr.has_value());
+  EXPECT_LE(ivr->first(), 3);
+  EXPECT_GE(ivr->second(), 3);
+  EXPECT_LT(ivr->second() - ivr->first(), Q(1, 1 << 30));
+
+  // Divisor whose interval contains zero
+  EXPECT_FALSE((1 / (sqrt2 - sqrt2)).evaluate(64).has_value());
+}
+
+TEST(AlgebraicExprTest, SeparationBits)
+{
+  using namespace alias::monomial::rational::x;
+
+  // x - 3 has norm sqrt(10) < 2^2
+  EXPECT_EQ(AlgebraicExpr(3).separation_bits(), 2);
+
+  const AlgebraicExpr sqrt2 = AlgebraicReal(x2 - 2, {1, 2});
+
+  EXPECT_EQ((-sqrt2).separation_bits(), sqrt2.separation_bits());
+  EXPECT_EQ((sqrt2 * 3).separation_bits(), sqrt2.separation_bits() + 2 * AlgebraicExpr(3).separation_bits());
+  EXPECT_EQ((sqrt2 + 3).separation_bits(), sqrt2.separation_bits() + 2 * AlgebraicExpr(3).separation_bits() + 2);
+}
+
+TEST(AlgebraicExprTest, Sign)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const AlgebraicExpr sqrt2 = AlgebraicReal(x2 - 2, {1, 2});
+  const AlgebraicExpr sqrt3 = AlgebraicReal(x2 - 3, {1, 2});
+  const AlgebraicExpr sqrt6 = AlgebraicReal(x2 - 6, {2, 3});
+
+  AlgebraicExpr::reset_materialization_count();
+
+  EXPECT_EQ((sqrt2 - Q(141, 100)).sign(), 1);
+  EXPECT_EQ((sqrt2 * sqrt3 - sqrt6).sign(), 0);
+  EXPECT_EQ(((sqrt2 + sqrt3) * (sqrt2 + sqrt3) - 5 - 2 * sqrt6).sign(), 0);
+  EXPECT_EQ((sqrt2 + sqrt3 - Q(1573, 500)).sign(), 1);
+
+  // Divisor is undecided at the first precision
+  const AlgebraicExpr tiny = sqrt2 - Q(1414213562373095, boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 15));
+
+  EXPECT_EQ((-1 / tiny).sign(), -1);
+
+  // Decided by intervals and the separation bound without any resultant
+  EXPECT_EQ(AlgebraicExpr::materialization_count(), 0);
+}
+
+TEST(AlgebraicExprTest, Comparison)
+{
+  using namespace alias::monomial::rational::x;
+
+  const AlgebraicExpr sqrt2 = AlgebraicReal(x2 - 2, {1, 2});
+  const AlgebraicExpr sqrt3 = AlgebraicReal(x2 - 3, {1, 2});
+
+  EXPECT_LT(sqrt2, sqrt3);
+  EXPECT_GT(sqrt3 * sqrt3, sqrt2 + 1);
+  EXPECT_LE(sqrt2 * sqrt2, 2);
+  EXPECT_GE(sqrt2 * sqrt2, 2);
+  EXPECT_EQ(sqrt2 / sqrt2, 1);
+  EXPECT_EQ(sqrt2, sqrt2);
+  EXPECT_NE(sqrt2 + sqrt3, sqrt3 + 1);
+}
+
+TEST(AlgebraicExprTest, Materialize)
+{
+  using namespace alias::monomial::rational::x;
+
+  const AlgebraicExpr sqrt2 = AlgebraicReal(x2 - 2, {1, 2});
+  const AlgebraicExpr sum = sqrt2 + 1;
+
+  AlgebraicExpr::reset_materialization_count();
+
+  EXPECT_EQ(sum.materialize(), AlgebraicReal(x2 - 2 * x - 1, {2, 3}));
+  EXPECT_EQ(AlgebraicExpr::materialization_count(), 1);
+
+  // Shared subexpression is materialized once
+  EXPECT_EQ((sum * sum - 2 * sum).materialize(), 1);
+  EXPECT_EQ(AlgebraicExpr::materialization_count(), 4);
+}
+
+TEST(AlgebraicExprTest, OutputStream)
+{
+  std::ostringstream os;
+
+  os << (AlgebraicExpr(1) + AlgebraicExpr(2)) * -AlgebraicExpr(3);
+
+  EXPECT_EQ(os.str(), "AlgExpr ((AlgReal 1/1 + AlgReal 2/1) * -(AlgReal 3/1))");
+}
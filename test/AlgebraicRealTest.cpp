@@ -72,6 +72,23 @@ TEST(AlgebraicRealTest, ConstructorWithRootIrrational)
   EXPECT_EQ(a.get_interval().second, 2);
 }
 
+TEST(AlgebraicRealTest, ConstructorWithSturmSequence)
+{
+  using namespace alias::monomial::rational::x;
+
+  AlgebraicReal a(SturmSequence(x2 - 2), {1, 2});
+  EXPECT_FALSE(a.get_from_rational());
+  EXPECT_EQ(a.defining_polynomial(), x2 - 2);
+  EXPECT_EQ(a.get_interval().first, 1);
+  EXPECT_EQ(a.get_interval().second, 2);
+  EXPECT_EQ(a, AlgebraicReal(x2 - 2, {1, 2}));
+
+  // Rational roots at the upper bound and at zero
+  EXPECT_EQ(AlgebraicReal(SturmSequence(x2 - 4), {1, 2}), 2);
+  EXPECT_EQ(AlgebraicReal(SturmSequence(x3 - x), {-Rational(1, 2), Rational(1, 2)}), 0);
+  EXPECT_EQ(AlgebraicReal(SturmSequence(x3 - 2 * x), {1, 2}), AlgebraicReal(x2 - 2, {1, 2}));
+}
+
 TEST(AlgebraicRealTest, UnaryPlus)
 {
   using namespace alias::monomial::rational::x;
@@ -161,6 +178,22 @@ TEST(AlgebraicRealTest, LessThan)
   EXPECT_TRUE(AlgebraicReal(1) < AlgebraicReal(x2 - 2, {1, 2}));
   EXPECT_TRUE(AlgebraicReal(x2 - 2, {1, 2}) < AlgebraicReal(2));
   EXPECT_TRUE(AlgebraicReal(x2 - 2, {1, 2}) < AlgebraicReal(x2 - 3, {1, 2}));
+
+  typedef Rational Q;
+
+  // Rational inside the interval of irrational: sqrt(2) is in (7/5, 3/2)
+  EXPECT_TRUE(AlgebraicReal(Q(7, 5)) < AlgebraicReal(x2 - 2, {1, 2}));
+  EXPECT_FALSE(AlgebraicReal(Q(3, 2)) < AlgebraicReal(x2 - 2, {1, 2}));
+  EXPECT_FALSE(AlgebraicReal(2) < AlgebraicReal(x2 - 2, {1, 2}));
+  // Other roots of the defining polynomial lie outside the interval
+  EXPECT_TRUE(AlgebraicReal(Q(7, 5)) < AlgebraicReal((x2 - 2) * (x2 - 3), {1, Q(3, 2)}));
+  EXPECT_FALSE(AlgebraicReal(Q(17, 12)) < AlgebraicReal((x2 - 2) * (x2 - 3), {1, Q(3, 2)}));
+
+  // Interval end beyond the range of double
+  const AlgebraicReal huge(x2 - Q(boost::multiprecision::cpp_int(1) << 2025, 1), {0, Q(boost::multiprecision::cpp_int(1) << 1013, 1)});
+
+  EXPECT_TRUE(AlgebraicReal(1) < huge);
+  EXPECT_FALSE(huge < AlgebraicReal(1));
 }
 
 TEST(AlgebraicRealTest, GreaterThan)
@@ -250,13 +283,62 @@ TEST(AlgebraicRealTest, NextIntervalWithSign)
   EXPECT_EQ(AlgebraicReal(x2 - 1, {0, 4}).next_interval_with_sign({0, 4}).to_pair().second, 2);
 }
 
+TEST(AlgebraicRealTest, RefineTo)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const Q width = Q(1, boost::multiprecision::cpp_int(1) << 1000);
+
+  const IntervalRational ivr = AlgebraicReal(x2 - 2, {1, 2}).refine_to(width);
+
+  EXPECT_LE(ivr.second() - ivr.first(), width);
+  EXPECT_LT(ivr.first() * ivr.first(), 2);
+  EXPECT_GT(ivr.second() * ivr.second(), 2);
+
+  // Root of reducible polynomial
+  const IntervalRational cubic_ivr = AlgebraicReal((x - 1) * (x3 - 3), {1, 2}).refine_to(IntervalRational(1, 2), Q(1, 1000000));
+
+  EXPECT_LE(cubic_ivr.second() - cubic_ivr.first(), Q(1, 1000000));
+  EXPECT_LT(cubic_ivr.first() * cubic_ivr.first() * cubic_ivr.first(), 3);
+  EXPECT_GT(cubic_ivr.second() * cubic_ivr.second() * cubic_ivr.second(), 3);
+
+  EXPECT_EQ(AlgebraicReal(Q(1, 3)).refine_to(Q(1, 100)).first(), Q(1, 3));
+  EXPECT_EQ(AlgebraicReal(Q(1, 3)).refine_to(Q(1, 100)).second(), Q(1, 3));
+
+  // N of QIR is carried over to the next call
+  boost::multiprecision::cpp_int subinterval_count = AlgebraicReal::initial_subinterval_count;
+
+  const IntervalRational coarse_ivr = AlgebraicReal(x2 - 2, {1, 2}).refine_to(IntervalRational(1, 2), Q(1, 1 << 20), subinterval_count);
+
+  EXPECT_GT(subinterval_count, AlgebraicReal::initial_subinterval_count);
+
+  const IntervalRational fine_ivr = AlgebraicReal(x2 - 2, {1, 2}).refine_to(coarse_ivr, width, subinterval_count);
+
+  EXPECT_LE(fine_ivr.second() - fine_ivr.first(), width);
+  EXPECT_LT(fine_ivr.first() * fine_ivr.first(), 2);
+  EXPECT_GT(fine_ivr.second() * fine_ivr.second(), 2);
+
+  // Width of irrational root can't reach zero
+  EXPECT_THROW(AlgebraicReal(x2 - 2, {1, 2}).refine_to(0), std::domain_error);
+  EXPECT_THROW(AlgebraicReal(x2 - 2, {1, 2}).refine_to(Q(-1, 100)), std::domain_error);
+}
+
 TEST(AlgebraicRealTest, RealRootsBetween)
 {
   using namespace alias::monomial::rational::x;
 
   typedef Rational Q;
 
-  std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots_between((x - 2) * (x - 6) * (x - 10), Q(4), Q(12));
+  std::vector<AlgebraicReal> rational_roots = AlgebraicReal::real_roots_between((x - 2) * (x - 6) * (x - 10), Q(4), Q(12));
+
+  EXPECT_EQ(rational_roots.size(), 2);
+  EXPECT_EQ(rational_roots.at(0), 6);
+  EXPECT_EQ(rational_roots.at(1), 10);
+
+  // Roots sqrt(37) and sqrt(101) are isolated by bisection of (4, 12]
+  std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots_between((x - 2) * (x2 - 37) * (x2 - 101), Q(4), Q(12));
 
   EXPECT_EQ(roots.size(), 2);
 
@@ -288,6 +370,284 @@ TEST(AlgebraicRealTest, RealRoots)
   EXPECT_EQ(roots.at(0).next_interval(IntervalRational(-2, 0)).second(), -1);
 }
 
+TEST(AlgebraicRealTest, RealRootsOnBoundary)
+{
+  using namespace alias::monomial::rational::x;
+
+  std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots((x + 1) * (x - 2));
+
+  EXPECT_EQ(roots.size(), 2);
+  EXPECT_EQ(roots.at(0), -1);
+  EXPECT_EQ(roots.at(1), 2);
+}
+
+TEST(AlgebraicRealTest, RealRootsRationalStripping)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const UnivariatePolynomial<Rational> p = (3 * x - 1) * (x - Q(7, 4)) * (x - Q(7, 4)) * (x2 - 2) * (x + 5);
+
+  for (const auto strategy : {IsolationStrategy::Sturm, IsolationStrategy::Descartes, IsolationStrategy::Aberth})
+  {
+    const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots(p, strategy);
+
+    ASSERT_EQ(roots.size(), 5);
+
+    EXPECT_EQ(roots.at(0), -5);
+    EXPECT_EQ(roots.at(2), Q(1, 3));
+    EXPECT_EQ(roots.at(4), Q(7, 4));
+    EXPECT_TRUE(roots.at(0).get_from_rational());
+    EXPECT_TRUE(roots.at(2).get_from_rational());
+    EXPECT_TRUE(roots.at(4).get_from_rational());
+
+    EXPECT_FALSE(roots.at(1).get_from_rational());
+    EXPECT_FALSE(roots.at(3).get_from_rational());
+    EXPECT_EQ(roots.at(3).defining_polynomial().to_monic(), x2 - 2);
+  }
+
+  // Rational roots out of (e1, e2] are divided out but not returned
+  const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots_between(p, Q(1, 3), Q(7, 4));
+
+  ASSERT_EQ(roots.size(), 2);
+  EXPECT_FALSE(roots.at(0).get_from_rational());
+  EXPECT_EQ(roots.at(1), Q(7, 4));
+}
+
+TEST(AlgebraicRealTest, RealRootsManyRoots)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // Enough roots to split bisection into parallel tasks
+  UnivariatePolynomial<Rational> p = 1;
+
+  for (int i = -8; i <= 8; i++)
+  {
+    p *= x - i - Q(1, 3);
+  }
+
+  const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots(p);
+
+  EXPECT_EQ(roots.size(), 17);
+
+  for (int i = -8; i <= 8; i++)
+  {
+    EXPECT_EQ(roots.at(i + 8), AlgebraicReal(i + Q(1, 3)));
+  }
+}
+
+TEST(AlgebraicRealTest, RealRootsCluster)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // Roots 1/3 and 1/3 + 2^-300 are separated after about 300 bisections
+  const Q gap = Q(1, boost::multiprecision::cpp_int(1) << 300);
+  const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots((x - Q(1, 3)) * (x - Q(1, 3) - gap) * (x2 - 2));
+
+  EXPECT_EQ(roots.size(), 4);
+  EXPECT_EQ(roots.at(1), Q(1, 3));
+  EXPECT_EQ(roots.at(2), Q(1, 3) + gap);
+  EXPECT_LT(roots.at(0), roots.at(1));
+  EXPECT_LT(roots.at(2), roots.at(3));
+}
+
+TEST(AlgebraicRealTest, RealRootsStrategy)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const std::vector<UnivariatePolynomial<Rational>> polynomials = {x2 - 2,
+                                                                   (x + 1) * (x - 2),
+                                                                   (x - 2) * (x - 6) * (x - 10),
+                                                                   x5 - 4 * x3 + x - Q(1, 3),
+                                                                   (x2 - 2) * (x2 - 2) * x};
+
+  for (const auto &p : polynomials)
+  {
+    const std::vector<AlgebraicReal> sturm_roots = AlgebraicReal::real_roots(p, IsolationStrategy::Sturm);
+    const std::vector<AlgebraicReal> descartes_roots = AlgebraicReal::real_roots(p, IsolationStrategy::Descartes);
+    const std::vector<AlgebraicReal> continued_fraction_roots = AlgebraicReal::real_roots(p, IsolationStrategy::ContinuedFraction);
+    const std::vector<AlgebraicReal> bitstream_roots = AlgebraicReal::real_roots(p, IsolationStrategy::BitstreamDescartes);
+    const std::vector<AlgebraicReal> aberth_roots = AlgebraicReal::real_roots(p, IsolationStrategy::Aberth);
+
+    EXPECT_EQ(descartes_roots.size(), sturm_roots.size());
+    EXPECT_EQ(continued_fraction_roots.size(), sturm_roots.size());
+    EXPECT_EQ(bitstream_roots.size(), sturm_roots.size());
+    EXPECT_EQ(aberth_roots.size(), sturm_roots.size());
+
+    for (size_t i = 0; i < std::min(descartes_roots.size(), sturm_roots.size()); i++)
+    {
+      EXPECT_EQ(descartes_roots.at(i), sturm_roots.at(i));
+    }
+
+    for (size_t i = 0; i < std::min(continued_fraction_roots.size(), sturm_roots.size()); i++)
+    {
+      EXPECT_EQ(continued_fraction_roots.at(i), sturm_roots.at(i));
+    }
+
+    for (size_t i = 0; i < std::min(bitstream_roots.size(), sturm_roots.size()); i++)
+    {
+      EXPECT_EQ(bitstream_roots.at(i), sturm_roots.at(i));
+    }
+
+    for (size_t i = 0; i < std::min(aberth_roots.size(), sturm_roots.size()); i++)
+    {
+      EXPECT_EQ(aberth_roots.at(i), sturm_roots.at(i));
+    }
+  }
+
+  for (const auto strategy : {IsolationStrategy::Descartes, IsolationStrategy::ContinuedFraction, IsolationStrategy::BitstreamDescartes, IsolationStrategy::Aberth})
+  {
+    const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots_between((x - 2) * (x - 6) * (x - 10), Q(4), Q(12), strategy);
+
+    EXPECT_EQ(roots.size(), 2);
+    EXPECT_EQ(roots.at(0), 6);
+    EXPECT_EQ(roots.at(1), 10);
+  }
+}
+
+TEST(AlgebraicRealTest, RealRootsAberthFallback)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // Roots 1 and 1 + 10^-20 are not separated in double, so bisection isolates them
+  const Q epsilon(1, boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 20));
+  const UnivariatePolynomial<Rational> p = (x - 1) * (x - 1 - epsilon) * (x2 - 3) * (x + 5);
+
+  const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots(p, IsolationStrategy::Aberth);
+  const std::vector<AlgebraicReal> sturm_roots = AlgebraicReal::real_roots(p);
+
+  ASSERT_EQ(roots.size(), 5);
+
+  for (size_t i = 0; i < roots.size(); i++)
+  {
+    EXPECT_EQ(roots.at(i), sturm_roots.at(i));
+  }
+
+  EXPECT_EQ(roots.at(2), 1);
+  EXPECT_EQ(roots.at(3), 1 + epsilon);
+}
+
+TEST(AlgebraicRealTest, RealRootsWithPrecision)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const Q precision = Q(1, boost::multiprecision::cpp_int(1) << 64);
+
+  for (const auto strategy : {IsolationStrategy::Sturm, IsolationStrategy::Descartes})
+  {
+    const std::vector<AlgebraicReal> roots = AlgebraicReal::real_roots((x - Q(1, 3)) * (x2 - 2) * (x3 - 5), precision, strategy);
+
+    EXPECT_EQ(roots.size(), 4);
+
+    for (const auto &each_root : roots)
+    {
+      EXPECT_LE(each_root.get_interval().second - each_root.get_interval().first, precision);
+    }
+
+    EXPECT_EQ(roots.at(1), Q(1, 3));
+    EXPECT_EQ(roots.at(2), AlgebraicReal(x2 - 2, {1, 2}));
+    EXPECT_EQ(roots.at(3), AlgebraicReal(x3 - 5, {1, 2}));
+  }
+
+  EXPECT_THROW(AlgebraicReal::real_roots(x2 - 2, 0), std::domain_error);
+  EXPECT_THROW(AlgebraicReal::real_roots(x2 - 2, Q(-1)), std::domain_error);
+}
+
+TEST(AlgebraicRealTest, RealRootsBatch)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // 1st, 3rd and 4th polynomials are equal up to constant factor
+  const std::vector<UnivariatePolynomial<Rational>> polynomials = {x2 - 2, x3 - 3 * x + 1, 2 * x2 - 4, -Q(1, 3) * x2 + Q(2, 3), x2 + 1};
+
+  const std::vector<std::vector<AlgebraicReal>> roots = AlgebraicReal::real_roots_batch(polynomials);
+
+  EXPECT_EQ(roots.size(), polynomials.size());
+
+  for (size_t i = 0; i < polynomials.size(); i++)
+  {
+    const std::vector<AlgebraicReal> expected_roots = AlgebraicReal::real_roots(polynomials.at(i));
+
+    EXPECT_EQ(roots.at(i).size(), expected_roots.size());
+
+    for (size_t j = 0; j < std::min(roots.at(i).size(), expected_roots.size()); j++)
+    {
+      EXPECT_EQ(roots.at(i).at(j), expected_roots.at(j));
+    }
+  }
+
+  std::vector<int> call_count(polynomials.size(), 0);
+
+  AlgebraicReal::real_roots_batch(
+      polynomials, [&call_count](const size_t index, const std::vector<AlgebraicReal> &each_roots)
+      { call_count.at(index)++; },
+      IsolationStrategy::Descartes);
+
+  EXPECT_EQ(call_count, std::vector<int>(polynomials.size(), 1));
+
+  EXPECT_THROW(AlgebraicReal::real_roots_batch({x, 0}), std::domain_error);
+}
+
+TEST(AlgebraicRealTest, MergedRealRoots)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // roots are -sqrt(2), 1, 2^(1/3), sqrt(2) and 3/2, where 1 and +-sqrt(2) are shared
+  const std::vector<UnivariatePolynomial<Rational>> polynomials = {(x2 - 2) * (x - 1), x3 - 2, (x - 1) * (x - Q(3, 2)), 2 * x2 - 4, x2 + 1};
+
+  const auto tagged_roots = AlgebraicReal::merged_real_roots(polynomials);
+
+  std::vector<AlgebraicReal> expected_roots;
+
+  for (const auto &p : polynomials)
+  {
+    for (const auto &each_root : AlgebraicReal::real_roots(p))
+    {
+      if (std::find(expected_roots.begin(), expected_roots.end(), each_root) == expected_roots.end())
+        expected_roots.push_back(each_root);
+    }
+  }
+
+  std::sort(expected_roots.begin(), expected_roots.end());
+
+  ASSERT_EQ(tagged_roots.size(), expected_roots.size());
+
+  for (size_t i = 0; i < tagged_roots.size(); i++)
+  {
+    EXPECT_EQ(tagged_roots.at(i).first, expected_roots.at(i));
+
+    // Intervals are separated in order
+    if (i + 1 < tagged_roots.size())
+    {
+      EXPECT_LE(tagged_roots.at(i).first.get_interval().second, tagged_roots.at(i + 1).first.get_interval().first);
+    }
+  }
+
+  // -sqrt(2), 1, 2^(1/3), sqrt(2), 3/2
+  EXPECT_EQ(tagged_roots.at(0).second, std::vector<size_t>({0, 3}));
+  EXPECT_EQ(tagged_roots.at(1).second, std::vector<size_t>({0, 2}));
+  EXPECT_EQ(tagged_roots.at(2).second, std::vector<size_t>({1}));
+  EXPECT_EQ(tagged_roots.at(3).second, std::vector<size_t>({0, 3}));
+  EXPECT_EQ(tagged_roots.at(4).second, std::vector<size_t>({2}));
+
+  EXPECT_THROW(AlgebraicReal::merged_real_roots({x, 0}), std::domain_error);
+}
+
 TEST(AlgebraicRealTest, Sign)
 {
   using namespace alias::monomial::rational::x;
@@ -310,6 +670,12 @@ TEST(AlgebraicRealTest, Pow)
   EXPECT_EQ(AlgebraicReal(x2 - 2, {1, 2}).pow(2), 2);
   EXPECT_EQ(AlgebraicReal(x4 - 2, {1, 2}).pow(2), AlgebraicReal(x2 - 2, {1, 2}));
 
+  // Powers with large index are reduced modulo the defining polynomial without expanding x^index
+  const boost::multiprecision::cpp_int two_power = boost::multiprecision::cpp_int(1) << 500;
+
+  EXPECT_EQ(AlgebraicReal(x2 - 2, {1, 2}).pow(1000), Q(two_power, 1));
+  EXPECT_EQ(AlgebraicReal(x2 - 2, {1, 2}).pow(1001), AlgebraicReal(x2 - Q(2 * two_power * two_power, 1), {Q(two_power, 1), Q(2 * two_power, 1)}));
+
   EXPECT_EQ(AlgebraicReal(8).pow(Q(2, 3)), 4);
   EXPECT_EQ(AlgebraicReal(x2 - 2, {1, 2}).pow(Q(3, 2)), AlgebraicReal(x4 - 8, {1, 2}));
 }
@@ -1,17 +1,32 @@
 #include <gtest/gtest.h>
 #include <iostream>
 
+#include "AberthIsolationTest.cpp"
+#include "AlgebraicExprTest.cpp"
 #include "AlgebraicRealTest.cpp"
 #include "AliasExtendedTest.cpp"
 #include "AliasMonomialTest.cpp"
+#include "BatchEvaluatorTest.cpp"
+#include "BitstreamDescartesTest.cpp"
+#include "BudgetTest.cpp"
+#include "ContinuedFractionIsolationTest.cpp"
+#include "DescartesIsolationTest.cpp"
 #include "ExtendedTest.cpp"
+#include "FactorizationTest.cpp"
+#include "FilteredPolynomialTest.cpp"
+#include "FloatingPointHornerTest.cpp"
+#include "IntegerPolynomialTest.cpp"
 #include "IntegerUtilsTest.cpp"
 #include "IntervalRationalTest.cpp"
 #include "MaybeBoolTest.cpp"
+#include "NumberFieldTest.cpp"
 #include "PolynomialRemainderSequenceTest.cpp"
 #include "RationalTest.cpp"
+#include "RootBoundTest.cpp"
 #include "SturmSequenceTest.cpp"
 #include "SylvesterMatrixTest.cpp"
+#include "TaskPoolTest.cpp"
+#include "ThreadLocalCounterTest.cpp"
 #include "UnivariatePolynomialTest.cpp"
 
 /*
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <AliasMonomial.h>
+#include <BatchEvaluator.h>
+
+/*
+  Test module for BatchEvaluator.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(BatchEvaluatorTest, EncloseAt)
+{
+  using namespace alias::monomial::rational::x;
+
+  std::vector<double> points;
+
+  for (int i = -20; i <= 20; i++)
+  {
+    points.push_back(i / 8.0);
+  }
+
+  auto enclosures = BatchEvaluator(x3 - 2 * x + Rational(1, 3)).enclose_at(points);
+
+  ASSERT_EQ(enclosures.size(), points.size());
+
+  for (size_t i = 0; i < points.size(); i++)
+  {
+    // Points are dyadic so that the exact value is a rational number with small denominator
+    Rational exact = (x3 - 2 * x + Rational(1, 3)).value_at(Rational(static_cast<int>(points.at(i) * 8), 8));
+
+    EXPECT_LE(enclosures.at(i).first, enclosures.at(i).second);
+    EXPECT_LE(enclosures.at(i).second - enclosures.at(i).first, 1e-12);
+    EXPECT_TRUE(Rational(static_cast<int>(std::floor(enclosures.at(i).first * (1 << 20))), 1 << 20) <= exact);
+    EXPECT_TRUE(exact <= Rational(static_cast<int>(std::ceil(enclosures.at(i).second * (1 << 20))), 1 << 20));
+  }
+}
+
+TEST(BatchEvaluatorTest, SignAt)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  std::vector<Rational> points = {-2, Q(-3, 2), -1, Q(-1, 3), 0, Q(1, 3), 1, Q(4, 3), Q(3, 2), 2, 3};
+
+  auto p = (x + 1) * (3 * x - 1) * (2 * x - 3);
+
+  std::vector<int> signs = BatchEvaluator(p).sign_at(points);
+
+  ASSERT_EQ(signs.size(), points.size());
+
+  for (size_t i = 0; i < points.size(); i++)
+  {
+    EXPECT_EQ(signs.at(i), p.value_at(points.at(i)).sign());
+  }
+}
+
+TEST(BatchEvaluatorTest, HugeCoefficient)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // Coefficients beyond 2^960 and below 2^-960 have no double approximation by themselves
+  const Q huge = Q(boost::multiprecision::cpp_int(1) << 1000, 1), tiny = Q(1, boost::multiprecision::cpp_int(1) << 1000);
+
+  // Exact value of finite double
+  const auto exact_rational = [](const double d)
+  {
+    int exponent;
+    const boost::multiprecision::cpp_int mantissa = static_cast<long long>(std::ldexp(std::frexp(d, &exponent), 53));
+
+    exponent -= 53;
+
+    return exponent >= 0 ? Q(mantissa << exponent, 1) : Q(mantissa, boost::multiprecision::cpp_int(1) << -exponent);
+  };
+
+  const std::vector<double> points = {-2, -1, 0.5, 1, 3};
+
+  for (const auto &p : {huge * (2 * x - 3), tiny * (x2 - 2) + tiny * tiny * x})
+  {
+    const auto enclosures = BatchEvaluator(p).enclose_at(points);
+
+    for (size_t i = 0; i < points.size(); i++)
+    {
+      const Q exact = p.value_at(Q(static_cast<int>(points.at(i) * 2), 2));
+      const Q lower = exact_rational(enclosures.at(i).first), upper = exact_rational(enclosures.at(i).second);
+
+      EXPECT_TRUE(lower <= exact);
+      EXPECT_TRUE(exact <= upper);
+      EXPECT_TRUE(upper - lower <= exact * exact.sign() * Q(1, 1ll << 40));
+    }
+  }
+
+  // Value beyond the range of double
+  const auto overflow = BatchEvaluator(huge * huge * (x - 1)).enclose_at({3});
+
+  EXPECT_EQ(overflow.at(0).first, -HUGE_VAL);
+  EXPECT_EQ(overflow.at(0).second, HUGE_VAL);
+
+  const std::vector<Rational> rational_points = {-1, Q(3, 2), 2};
+
+  EXPECT_EQ(BatchEvaluator(huge * huge * (2 * x - 3)).sign_at(rational_points), (std::vector{-1, 0, 1}));
+  EXPECT_EQ(BatchEvaluator(tiny * tiny * (2 * x - 3)).sign_at(rational_points), (std::vector{-1, 0, 1}));
+}
+
+TEST(BatchEvaluatorTest, Zero)
+{
+  const auto enclosures = BatchEvaluator(UnivariatePolynomial<Rational>()).enclose_at({1, 2});
+
+  EXPECT_EQ(enclosures.at(1), std::make_pair(0.0, 0.0));
+  EXPECT_EQ(BatchEvaluator(UnivariatePolynomial<Rational>()).sign_at({1, 2}), (std::vector{0, 0}));
+}
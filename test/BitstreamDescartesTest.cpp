@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <AliasMonomial.h>
+#include <BitstreamDescartes.h>
+#include <DescartesIsolation.h>
+#include <SturmSequence.h>
+
+/*
+  Test module for BitstreamDescartes.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(BitstreamDescartesTest, Isolate)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  const auto intervals = BitstreamDescartes::isolate(x2 - 2, -2, 2);
+
+  EXPECT_EQ(intervals.size(), 2);
+  EXPECT_EQ(intervals.at(0), std::make_pair(Q(-2), Q(0)));
+  EXPECT_EQ(intervals.at(1), std::make_pair(Q(0), Q(2)));
+
+  EXPECT_TRUE(BitstreamDescartes::isolate(x2 + 1, -4, 4).empty());
+  EXPECT_TRUE(BitstreamDescartes::isolate(x - 1, 2, 4).empty());
+}
+
+TEST(BitstreamDescartesTest, IsolateRationalRoots)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  // 0 is the middle, 2 is the upper end and -2 is out of (lower, upper]
+  const auto intervals = BitstreamDescartes::isolate((x + 2) * x * (x - 1) * (x - 2), -2, 2);
+
+  EXPECT_EQ(intervals.size(), 3);
+  EXPECT_EQ(intervals.at(0), std::make_pair(Q(0), Q(0)));
+  EXPECT_EQ(intervals.at(1), std::make_pair(Q(1), Q(1)));
+  EXPECT_EQ(intervals.at(2), std::make_pair(Q(2), Q(2)));
+}
+
+TEST(BitstreamDescartesTest, IsolateHugeCoefficients)
+{
+  using namespace alias::monomial::integer::x;
+
+  // 3^500 (x^2 - 2)(x - 1/3) + 1 has coefficients of about 800 bits and three roots
+  const boost::multiprecision::cpp_int big = boost::multiprecision::pow(boost::multiprecision::cpp_int(3), 500);
+  const UnivariatePolynomial<boost::multiprecision::cpp_int> p = big * (x2 - 2) * (3 * x - 1) + 1;
+
+  const auto intervals = BitstreamDescartes::isolate(p, -4, 4);
+  const auto exact_intervals = DescartesIsolation::isolate(p, -4, 4);
+
+  EXPECT_EQ(intervals.size(), 3);
+  EXPECT_EQ(intervals, exact_intervals);
+}
+
+TEST(BitstreamDescartesTest, IsolateCloseRoots)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // roots are 1 and 1.001
+  const UnivariatePolynomial<Rational> p = (x - 1) * (x - Q(1001, 1000)) * (x + 5) * (x2 - 3);
+  const SturmSequence<Rational> sturm_sequence(p);
+
+  const auto intervals = BitstreamDescartes::isolate(IntegerPolynomial::primitive_part(p), -8, 8);
+
+  EXPECT_EQ(intervals.size(), 5);
+
+  for (size_t i = 0; i + 1 < intervals.size(); i++)
+  {
+    EXPECT_LE(intervals.at(i).second, intervals.at(i + 1).first);
+  }
+
+  for (const auto &[lower, upper] : intervals)
+  {
+    if (lower == upper)
+    {
+      EXPECT_EQ(p.value_at(upper), 0);
+    }
+    else
+    {
+      EXPECT_EQ(sturm_sequence.count_real_roots_between(lower, upper), 1);
+      EXPECT_NE(p.value_at(upper), 0);
+    }
+  }
+}
+
+TEST(BitstreamDescartesTest, IsolateAfterPrecisionDoubling)
+{
+  using namespace alias::monomial::integer::x;
+
+  // x^20 - 2 (10^30 x - 1)^2 has two roots in (-4, 4), within about 10^-330 of 10^-30, which need precision doublings
+  const boost::multiprecision::cpp_int k = boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 30);
+  const UnivariatePolynomial<boost::multiprecision::cpp_int> p = x.pow(20) - 2 * (k * x - 1) * (k * x - 1);
+
+  const auto intervals = BitstreamDescartes::isolate(p, -4, 4);
+  const auto exact_intervals = DescartesIsolation::isolate(p, -4, 4);
+
+  EXPECT_EQ(intervals.size(), 2);
+  EXPECT_EQ(intervals, exact_intervals);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <AlgebraicReal.h>
+#include <AliasMonomial.h>
+#include <Budget.h>
+#include <SylvesterMatrix.h>
+#include <TaskPool.h>
+
+/*
+  Test module for Budget.cpp
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(BudgetTest, Steps)
+{
+  Budget budget(3);
+  Budget::Scope scope(budget);
+
+  EXPECT_EQ(Budget::current(), &budget);
+
+  Budget::charge();
+  Budget::charge(2);
+
+  EXPECT_EQ(budget.steps(), 3);
+
+  try
+  {
+    Budget::charge();
+    FAIL();
+  }
+  catch (const BudgetExhausted &e)
+  {
+    EXPECT_EQ(e.reason(), BudgetExhausted::Reason::Steps);
+  }
+}
+
+TEST(BudgetTest, Time)
+{
+  Budget budget(std::nullopt, std::chrono::milliseconds(1));
+  Budget::Scope scope(budget);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  try
+  {
+    Budget::charge();
+    FAIL();
+  }
+  catch (const BudgetExhausted &e)
+  {
+    EXPECT_EQ(e.reason(), BudgetExhausted::Reason::Time);
+  }
+}
+
+TEST(BudgetTest, Cancelled)
+{
+  CancellationToken token;
+  Budget budget(std::nullopt, std::nullopt, token);
+  Budget::Scope scope(budget);
+
+  Budget::charge();
+
+  // Copy of the token cancels the same computation
+  CancellationToken copied_token = token;
+  copied_token.cancel();
+
+  EXPECT_TRUE(token.is_cancelled());
+
+  try
+  {
+    Budget::charge();
+    FAIL();
+  }
+  catch (const BudgetExhausted &e)
+  {
+    EXPECT_EQ(e.reason(), BudgetExhausted::Reason::Cancelled);
+  }
+}
+
+TEST(BudgetTest, Scope)
+{
+  EXPECT_EQ(Budget::current(), nullptr);
+
+  // Without budget, charge does nothing
+  EXPECT_NO_THROW(Budget::charge(1000));
+
+  Budget outer_budget(10), inner_budget(0);
+
+  {
+    Budget::Scope outer_scope(outer_budget);
+
+    {
+      Budget::Scope inner_scope(inner_budget);
+      EXPECT_THROW(Budget::charge(), BudgetExhausted);
+    }
+
+    EXPECT_EQ(Budget::current(), &outer_budget);
+    EXPECT_NO_THROW(Budget::charge());
+
+    {
+      Budget::Scope no_budget_scope(nullptr);
+      EXPECT_NO_THROW(Budget::charge(1000));
+    }
+  }
+
+  EXPECT_EQ(Budget::current(), nullptr);
+}
+
+TEST(BudgetTest, TaskInheritsBudget)
+{
+  Budget budget(0);
+  Budget::Scope scope(budget);
+
+  TaskGroup group(TaskPool::shared());
+
+  group.run([]
+            { Budget::charge(); });
+
+  EXPECT_THROW(group.wait(), BudgetExhausted);
+}
+
+TEST(BudgetTest, ExhaustedInExactOperations)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  UnivariatePolynomial<Rational> p = 1;
+
+  for (int i = 1; i <= 12; i++)
+  {
+    p *= x - Q(i, 7);
+  }
+
+  {
+    Budget budget(5);
+    Budget::Scope scope(budget);
+
+    EXPECT_THROW(AlgebraicReal::real_roots(p), BudgetExhausted);
+  }
+
+  {
+    Budget budget(2);
+    Budget::Scope scope(budget);
+
+    EXPECT_THROW(SylvesterMatrix::resultant(p, p.differential()), BudgetExhausted);
+  }
+
+  // sqrt(2) and sqrt(2) + 10^-30 are compared after many refinement steps
+  const AlgebraicReal sqrt2 = AlgebraicReal(2).sqrt();
+  const AlgebraicReal near_sqrt2 = sqrt2 + AlgebraicReal(Q(1, boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 30)));
+
+  {
+    Budget budget(3);
+    Budget::Scope scope(budget);
+
+    EXPECT_THROW((void)(sqrt2 < near_sqrt2), BudgetExhausted);
+  }
+
+  // Enough budget gives the same result as without budget
+  Budget budget(1000000);
+  Budget::Scope scope(budget);
+
+  EXPECT_TRUE(sqrt2 < near_sqrt2);
+  EXPECT_EQ(AlgebraicReal::real_roots(p).size(), 12);
+  EXPECT_GT(budget.steps(), 0);
+}
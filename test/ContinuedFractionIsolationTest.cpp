@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <AliasMonomial.h>
+#include <ContinuedFractionIsolation.h>
+#include <SturmSequence.h>
+
+/*
+  Test module for ContinuedFractionIsolation.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(ContinuedFractionIsolationTest, Isolate)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  const auto intervals = ContinuedFractionIsolation::isolate(x2 - 2, -2, 2);
+
+  EXPECT_EQ(intervals.size(), 2);
+  EXPECT_EQ(intervals.at(0), std::make_pair(Q(-2), Q(0)));
+  EXPECT_EQ(intervals.at(1), std::make_pair(Q(0), Q(2)));
+
+  EXPECT_TRUE(ContinuedFractionIsolation::isolate(x2 + 1, -4, 4).empty());
+  EXPECT_TRUE(ContinuedFractionIsolation::isolate(x - 1, 2, 4).empty());
+}
+
+TEST(ContinuedFractionIsolationTest, IsolateRationalRoots)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  // 0 is the middle, 2 is the upper end and -2 is out of (lower, upper]
+  const auto intervals = ContinuedFractionIsolation::isolate((x + 2) * x * (x - 1) * (x - 2), -2, 2);
+
+  EXPECT_EQ(intervals.size(), 3);
+  EXPECT_EQ(intervals.at(0), std::make_pair(Q(0), Q(0)));
+  EXPECT_EQ(intervals.at(1), std::make_pair(Q(1), Q(1)));
+  EXPECT_EQ(intervals.at(2), std::make_pair(Q(2), Q(2)));
+}
+
+TEST(ContinuedFractionIsolationTest, IsolateCloseRoots)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // roots are 1 and 1.001
+  const UnivariatePolynomial<Rational> p = (x - 1) * (x - Q(1001, 1000)) * (x + 5) * (x2 - 3);
+  const SturmSequence<Rational> sturm_sequence(p);
+
+  const auto intervals = ContinuedFractionIsolation::isolate(IntegerPolynomial::primitive_part(p), -8, 8);
+
+  EXPECT_EQ(intervals.size(), 5);
+
+  for (size_t i = 0; i + 1 < intervals.size(); i++)
+  {
+    EXPECT_LE(intervals.at(i).second, intervals.at(i + 1).first);
+  }
+
+  for (const auto &[lower, upper] : intervals)
+  {
+    if (lower == upper)
+    {
+      EXPECT_EQ(p.value_at(upper), 0);
+    }
+    else
+    {
+      EXPECT_EQ(sturm_sequence.count_real_roots_between(lower, upper), 1);
+      EXPECT_NE(p.value_at(upper), 0);
+    }
+  }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <AliasMonomial.h>
+#include <Factorization.h>
+
+/*
+  Test module for Factorization.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(FactorizationTest, SquareFreeDecomposition)
+{
+  using namespace alias::monomial::rational::x;
+
+  const auto decomposition = Factorization::square_free_decomposition(3 * (x - 1) * (x - 1) * (x - 1) * (x2 + 1) * (x + 2) * (x + 2));
+
+  ASSERT_EQ(decomposition.size(), 3);
+  EXPECT_EQ(decomposition.at(0), std::make_pair(x2 + 1, 1));
+  EXPECT_EQ(decomposition.at(1), std::make_pair(x + 2, 2));
+  EXPECT_EQ(decomposition.at(2), std::make_pair(x - 1, 3));
+
+  EXPECT_TRUE(Factorization::square_free_decomposition(UnivariatePolynomial<Rational>(5)).empty());
+  EXPECT_THROW(Factorization::square_free_decomposition(UnivariatePolynomial<Rational>()), std::domain_error);
+}
+
+TEST(FactorizationTest, SquareFreeFactors)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(Factorization::square_free_factors((x2 - 2) * (x2 - 3)), (std::vector{x2 - 3, x2 - 2}));
+  EXPECT_EQ(Factorization::square_free_factors(-6 * (2 * x - 1) * (x + 1)), (std::vector{2 * x - 1, x + 1}));
+  EXPECT_EQ(Factorization::square_free_factors(3 * x + 6), std::vector{x + 2});
+  EXPECT_TRUE(Factorization::square_free_factors(UnivariatePolynomial<boost::multiprecision::cpp_int>(7)).empty());
+
+  // Irreducible over integers, but splits into factors of degree at most 2 modulo every prime
+  EXPECT_EQ(Factorization::square_free_factors(x4 + 1), std::vector{x4 + 1});
+  EXPECT_EQ(Factorization::square_free_factors(x4 - 10 * x2 + 1), std::vector{x4 - 10 * x2 + 1});
+
+  // Recombination of pairs of modular factors
+  EXPECT_EQ(Factorization::square_free_factors((x4 + 1) * (x4 - 10 * x2 + 1)), (std::vector{x4 - 10 * x2 + 1, x4 + 1}));
+
+  // Square-free, but not modulo 3
+  EXPECT_EQ(Factorization::square_free_factors((x - 1) * (x - 4)), (std::vector{x - 4, x - 1}));
+
+  EXPECT_THROW(Factorization::square_free_factors(UnivariatePolynomial<boost::multiprecision::cpp_int>()), std::domain_error);
+  // Not square-free modulo any prime
+  EXPECT_THROW(Factorization::square_free_factors((x - 1) * (x - 1)), std::domain_error);
+  EXPECT_THROW(Factorization::square_free_factors((x2 - 2) * (x2 - 2) * (x + 3)), std::domain_error);
+}
+
+TEST(FactorizationTest, LargeCoefficients)
+{
+  using namespace alias::monomial::integer::x;
+
+  const boost::multiprecision::cpp_int large = boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 30) + 7;
+
+  const auto f = (x3 - large * x + 1) * (large * x2 + x - 3) * (x - 5);
+
+  EXPECT_EQ(Factorization::square_free_factors(f), (std::vector{x - 5, large * x2 + x - 3, x3 - large * x + 1}));
+}
+
+TEST(FactorizationTest, RationalRoots)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  EXPECT_EQ(Factorization::rational_roots((2 * x - 1) * (3 * x + 4) * x * (x2 - 2)), (std::vector{Q(-4, 3), Q(0), Q(1, 2)}));
+  EXPECT_EQ(Factorization::rational_roots(-5 * x + 7), std::vector{Q(7, 5)});
+  EXPECT_TRUE(Factorization::rational_roots(x4 - 10 * x2 + 1).empty());
+  EXPECT_TRUE(Factorization::rational_roots(UnivariatePolynomial<boost::multiprecision::cpp_int>(3)).empty());
+
+  // Roots modulo small primes which are not rational roots are rejected after lifting
+  EXPECT_EQ(Factorization::rational_roots((x2 + 1) * (x2 + 2) * (x - 1000)), std::vector{Q(1000)});
+
+  const boost::multiprecision::cpp_int large = boost::multiprecision::pow(boost::multiprecision::cpp_int(3), 80);
+
+  EXPECT_EQ(Factorization::rational_roots((large * x + 1) * (x - large) * (x3 - 3)), (std::vector{Q(-1, large), Q(large, 1)}));
+
+  // Quadratic
+  EXPECT_EQ(Factorization::rational_roots((-2 * x + 1) * (x + 3)), (std::vector{Q(-3), Q(1, 2)}));
+  EXPECT_EQ(Factorization::rational_roots(x * (6 * x2 - x - 1)), (std::vector{Q(-1, 3), Q(0), Q(1, 2)}));
+  EXPECT_TRUE(Factorization::rational_roots(x2 - 2).empty());
+  EXPECT_TRUE(Factorization::rational_roots(x2 + 1).empty());
+
+  EXPECT_THROW(Factorization::rational_roots(UnivariatePolynomial<boost::multiprecision::cpp_int>()), std::domain_error);
+  // Not square-free
+  EXPECT_THROW(Factorization::rational_roots((x - 1) * (x - 1)), std::domain_error);
+  EXPECT_THROW(Factorization::rational_roots((x - 1) * (x - 1) * (x2 + 1)), std::domain_error);
+  EXPECT_THROW(Factorization::rational_roots(x2 * (x - 1)), std::domain_error);
+  EXPECT_THROW(Factorization::rational_roots(4 * x2 - 4 * x + 1), std::domain_error);
+  EXPECT_THROW(Factorization::rational_roots((x2 - 2) * (x2 - 2) * (x + 3)), std::domain_error);
+  EXPECT_THROW(Factorization::rational_roots((x + large) * (x + large) * (x3 - 3)), std::domain_error);
+}
+
+TEST(FactorizationTest, Factor)
+{
+  {
+    using namespace alias::monomial::integer::x;
+
+    const auto f = 2 * (x - 1) * (x - 1) * (x - 1) * (x2 + 1) * (x2 - 2) * (x2 - 2);
+    const auto factors = Factorization::factor(f);
+
+    ASSERT_EQ(factors.size(), 3);
+    EXPECT_EQ(factors.at(0), std::make_pair(x2 + 1, 1));
+    EXPECT_EQ(factors.at(1), std::make_pair(x2 - 2, 2));
+    EXPECT_EQ(factors.at(2), std::make_pair(x - 1, 3));
+
+    // Product of factors is f up to constant
+    UnivariatePolynomial<boost::multiprecision::cpp_int> product = 2;
+
+    for (const auto &[factor, multiplicity] : factors)
+    {
+      for (int i = 0; i < multiplicity; i++)
+      {
+        product = product * factor;
+      }
+    }
+
+    EXPECT_EQ(product, f);
+  }
+
+  {
+    using namespace alias::monomial::rational::x;
+
+    const auto factors = Factorization::factor(Rational(1, 2) * (x2 - Rational(1, 4)) * (x2 + x + 1));
+
+    ASSERT_EQ(factors.size(), 3);
+    EXPECT_EQ(factors.at(0), std::make_pair(x - Rational(1, 2), 1));
+    EXPECT_EQ(factors.at(1), std::make_pair(x + Rational(1, 2), 1));
+    EXPECT_EQ(factors.at(2), std::make_pair(x2 + x + 1, 1));
+  }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <AliasMonomial.h>
+#include <FilteredPolynomial.h>
+
+/*
+  Test module for FilteredPolynomial.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(FilteredPolynomialTest, Integer)
+{
+  using namespace alias::monomial::rational::x;
+  using boost::multiprecision::cpp_int;
+
+  EXPECT_EQ(FilteredPolynomial(x2 / 2 - 1).integer(), UnivariatePolynomial<cpp_int>({-2, 0, 1}));
+}
+
+TEST(FilteredPolynomialTest, ApproximateSignAt)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  FilteredPolynomial p(x2 - 2);
+
+  EXPECT_EQ(p.approximate_sign_at(Q(3, 2)), 1);
+  EXPECT_EQ(p.approximate_sign_at(Q(-4, 3)), -1);
+  EXPECT_EQ(p.approximate_sign_at(0), -1);
+
+  // Exact zero cannot be decided by the filter
+  EXPECT_FALSE(FilteredPolynomial(x3 - 8).approximate_sign_at(2).has_value());
+
+  // Value much smaller than the size of terms cannot be decided
+  boost::multiprecision::cpp_int big = boost::multiprecision::cpp_int(1) << 80;
+  EXPECT_FALSE(FilteredPolynomial(x2 - boost::multiprecision::cpp_int(big * big + 1)).approximate_sign_at(Rational(big, 1)).has_value());
+}
+
+TEST(FilteredPolynomialTest, ApproximateSignOn)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  FilteredPolynomial p(x2 - 2);
+
+  EXPECT_EQ(p.approximate_sign_on(Q(3, 2), 2), 1);
+  EXPECT_EQ(p.approximate_sign_on(-2, Q(-3, 2)), 1);
+  EXPECT_EQ(p.approximate_sign_on(Q(-1, 2), Q(1, 2)), -1);
+
+  // Interval containing a root
+  EXPECT_FALSE(p.approximate_sign_on(1, 2).has_value());
+  // Interval arithmetic overestimates the range: x^2 - 2 over [-1, 1] is enclosed by [-3, -1]
+  EXPECT_EQ(p.approximate_sign_on(-1, 1), -1);
+  // Root at the end
+  EXPECT_FALSE(FilteredPolynomial(x3 - 8).approximate_sign_on(0, 2).has_value());
+
+  // Ends without double approximation are undecided
+  const boost::multiprecision::cpp_int power = boost::multiprecision::cpp_int(1) << 1100;
+  const FilteredPolynomial huge_root(x2 - (boost::multiprecision::cpp_int(1) << 2001));
+
+  EXPECT_FALSE(huge_root.approximate_sign_on(0, Q(power, 1)).has_value());
+  EXPECT_FALSE(huge_root.approximate_sign_on(-Q(power, 1), 0).has_value());
+  EXPECT_FALSE(p.approximate_sign_on(Q(1, power), Q(power, 1)).has_value());
+}
+
+TEST(FilteredPolynomialTest, SignAt)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  boost::multiprecision::cpp_int big = boost::multiprecision::cpp_int(1) << 80;
+
+  FilteredPolynomial::reset_filter_counters();
+
+  EXPECT_EQ(FilteredPolynomial(x2 - 2).sign_at(Q(3, 2)), 1);
+  EXPECT_EQ(FilteredPolynomial(x3 - 8).sign_at(2), 0);
+  EXPECT_EQ(FilteredPolynomial(x2 - boost::multiprecision::cpp_int(big * big + 1)).sign_at(Rational(big, 1)), -1);
+  EXPECT_EQ(FilteredPolynomial(x2 - boost::multiprecision::cpp_int(big * big - 1)).sign_at(Rational(big, 1)), 1);
+
+  EXPECT_EQ(FilteredPolynomial::filter_hits(), 1);
+  EXPECT_EQ(FilteredPolynomial::filter_misses(), 3);
+  EXPECT_DOUBLE_EQ(FilteredPolynomial::filter_hit_rate(), 0.25);
+
+  FilteredPolynomial::reset_filter_counters();
+
+  EXPECT_EQ(FilteredPolynomial::filter_hits(), 0);
+  EXPECT_EQ(FilteredPolynomial::filter_hit_rate(), 0);
+}
+
+TEST(FilteredPolynomialTest, SignAtHugeCoefficient)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  boost::multiprecision::cpp_int huge = boost::multiprecision::cpp_int(1) << 3000;
+
+  FilteredPolynomial p(huge * x2 - boost::multiprecision::cpp_int(huge * 2 - 1));
+
+  EXPECT_EQ(p.sign_at(Q(3, 2)), 1);
+  EXPECT_EQ(p.sign_at(Q(1, 2)), -1);
+  EXPECT_EQ(p.sign_at(Rational(huge, 1)), 1);
+}
+
+TEST(FilteredPolynomialTest, SignAtManyPoints)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  boost::multiprecision::cpp_int big = boost::multiprecision::cpp_int(1) << 80;
+
+  FilteredPolynomial p(x2 - boost::multiprecision::cpp_int(big * big + 1));
+
+  EXPECT_EQ(p.sign_at(std::vector<Rational>({0, Rational(big, 1), Rational(big + 1, 1), Q(-1, 2)})), std::vector<int>({-1, -1, 1, -1}));
+  EXPECT_EQ(FilteredPolynomial(x2 - 4).sign_at(std::vector<Rational>({-3, -2, -1, 0, 1, 2, 3, 4, 5})), std::vector<int>({1, 0, -1, -1, -1, 0, 1, 1, 1}));
+}
+
+TEST(FilteredPolynomialTest, SignAtApproximatePoints)
+{
+  using namespace alias::monomial::integer::x;
+
+  const std::vector<Rational> points({-3, -2, 0, 2, 3});
+  std::vector<double> approximate_points(points.size());
+
+  std::transform(points.begin(), points.end(), approximate_points.begin(), FloatingPointHorner::approximate);
+
+  std::vector<size_t> exact_points;
+
+  const auto signs = FilteredPolynomial(x2 - 4).sign_at(approximate_points, [&](const size_t i)
+                                                         {
+                                                           exact_points.push_back(i);
+                                                           return IntegerPolynomial::sign_at(x2 - 4, points.at(i));
+                                                         });
+
+  EXPECT_EQ(signs, std::vector<int>({1, 0, -1, 0, 1}));
+
+  // Only roots are undecided by the filter
+  EXPECT_EQ(exact_points, std::vector<size_t>({1, 3}));
+}
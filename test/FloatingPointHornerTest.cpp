@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <FloatingPointHorner.h>
+
+/*
+  Test module for FloatingPointHorner.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(FloatingPointHornerTest, Split)
+{
+  EXPECT_EQ(FloatingPointHorner::split(0), std::make_pair(0.0, 0));
+  EXPECT_EQ(FloatingPointHorner::split(-5), std::make_pair(5.0, 0));
+  EXPECT_EQ(FloatingPointHorner::split(boost::multiprecision::cpp_int(3) << 100), std::make_pair(3.0 * (1ull << 51), 49));
+}
+
+TEST(FloatingPointHornerTest, Approximate)
+{
+  typedef Rational Q;
+
+  EXPECT_DOUBLE_EQ(FloatingPointHorner::approximate(Q(1, 3)), 1.0 / 3);
+  EXPECT_DOUBLE_EQ(FloatingPointHorner::approximate(Q(7, -2)), -3.5);
+  EXPECT_TRUE(std::isnan(FloatingPointHorner::approximate(Rational(boost::multiprecision::cpp_int(1) << 2000, 1))));
+}
+
+TEST(FloatingPointHornerTest, Evaluate)
+{
+  // 1 - 3x + x^3 at 13 points so that both SIMD lanes and scalar rest are used
+  std::vector<double> coefficients = {1, -3, 0, 1}, absolute_errors(4, 0);
+  std::vector<double> points, values(13), error_bounds(13);
+
+  for (int i = 0; i < 13; i++)
+  {
+    points.push_back(-3 + i * 0.5);
+  }
+
+  FloatingPointHorner::evaluate(coefficients.data(), absolute_errors.data(), 4, 0, points.data(), 0, 13, values.data(), error_bounds.data());
+
+  for (int i = 0; i < 13; i++)
+  {
+    double x = points.at(i);
+    EXPECT_NEAR(values.at(i), 1 - 3 * x + x * x * x, error_bounds.at(i));
+    EXPECT_GT(error_bounds.at(i), 0);
+    EXPECT_LT(error_bounds.at(i), 1e-12);
+  }
+
+  std::vector<double> huge_point = {1e300}, huge_value(1), huge_bound(1);
+
+  FloatingPointHorner::evaluate(coefficients.data(), absolute_errors.data(), 4, 0, huge_point.data(), 0, 1, huge_value.data(), huge_bound.data());
+
+  EXPECT_EQ(huge_bound.at(0), HUGE_VAL);
+}
+
+TEST(FloatingPointHornerTest, EvaluateOnInterval)
+{
+  // 1 - 3x + x^3
+  std::vector<double> coefficients = {1, -3, 0, 1}, absolute_errors(4, 0);
+
+  double lower_value, upper_value, error_bound;
+
+  FloatingPointHorner::evaluate_on_interval(coefficients.data(), absolute_errors.data(), 4, 0, 2, 3, 0, &lower_value, &upper_value, &error_bound);
+
+  // Range over [2, 3] is [3, 19], and interval arithmetic encloses it
+  EXPECT_LE(lower_value, 3 + error_bound);
+  EXPECT_GE(upper_value, 19 - error_bound);
+  EXPECT_GT(lower_value, error_bound);
+
+  // Range over [0, 1] contains the root near 0.347
+  FloatingPointHorner::evaluate_on_interval(coefficients.data(), absolute_errors.data(), 4, 0, 0, 1, 0, &lower_value, &upper_value, &error_bound);
+
+  EXPECT_LT(lower_value, 0);
+  EXPECT_GT(upper_value, 0);
+
+  FloatingPointHorner::evaluate_on_interval(coefficients.data(), absolute_errors.data(), 4, 0, 1, 1e300, 0, &lower_value, &upper_value, &error_bound);
+
+  EXPECT_EQ(error_bound, HUGE_VAL);
+
+  // End which has no approximation
+  FloatingPointHorner::evaluate_on_interval(coefficients.data(), absolute_errors.data(), 4, 0, 2, std::nan(""), 0, &lower_value, &upper_value, &error_bound);
+
+  EXPECT_EQ(error_bound, HUGE_VAL);
+  EXPECT_FALSE(lower_value > error_bound);
+  EXPECT_FALSE(upper_value < -error_bound);
+}
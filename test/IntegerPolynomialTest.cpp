@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <AliasMonomial.h>
+#include <IntegerPolynomial.h>
+
+/*
+  Test module for IntegerPolynomial.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(IntegerPolynomialTest, PrimitivePart)
+{
+  typedef Rational Q;
+
+  EXPECT_EQ(IntegerPolynomial::primitive_part(UnivariatePolynomial<Rational>({Q(1, 2), Q(-1, 3), 1})),
+            UnivariatePolynomial<boost::multiprecision::cpp_int>({3, -2, 6}));
+  EXPECT_EQ(IntegerPolynomial::primitive_part(UnivariatePolynomial<Rational>({4, -6, 2})),
+            UnivariatePolynomial<boost::multiprecision::cpp_int>({2, -3, 1}));
+  EXPECT_EQ(IntegerPolynomial::primitive_part(UnivariatePolynomial<Rational>({Q(1, -2), -1})),
+            UnivariatePolynomial<boost::multiprecision::cpp_int>({-1, -2}));
+}
+
+TEST(IntegerPolynomialTest, HomogenizedValueAt)
+{
+  using namespace alias::monomial::integer::x;
+
+  // 3^2 * ((2/3)^2 - 2) = 4 - 18
+  EXPECT_EQ(IntegerPolynomial::homogenized_value_at(x2 - 2, 2, 3), -14);
+  EXPECT_EQ(IntegerPolynomial::homogenized_value_at(UnivariatePolynomial<boost::multiprecision::cpp_int>(), 2, 3), 0);
+}
+
+TEST(IntegerPolynomialTest, SignVariations)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::sign_variations((x - 1) * (x - 2) * (x + 3)), 2);
+  EXPECT_EQ(IntegerPolynomial::sign_variations(x3 + 1), 0);
+  EXPECT_EQ(IntegerPolynomial::sign_variations(x3 - 1), 1);
+}
+
+TEST(IntegerPolynomialTest, Reverse)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::reverse(2 * x2 + 3 * x + 5), 5 * x2 + 3 * x + 2);
+  EXPECT_EQ(IntegerPolynomial::reverse(x2 + x), x + 1);
+}
+
+TEST(IntegerPolynomialTest, TaylorShift)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::taylor_shift(x2 - 2, 1), x2 + 2 * x - 1);
+  EXPECT_EQ(IntegerPolynomial::taylor_shift(x3, -2), (x - 2) * (x - 2) * (x - 2));
+}
+
+TEST(IntegerPolynomialTest, HalfArgument)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::half_argument(x2 - 2), x2 - 8);
+  EXPECT_EQ(IntegerPolynomial::half_argument(x3 + x), x3 + 4 * x);
+}
+
+TEST(IntegerPolynomialTest, RemovePowerOfTwoContent)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::remove_power_of_two_content(4 * x2 - 12), x2 - 3);
+  EXPECT_EQ(IntegerPolynomial::remove_power_of_two_content(2 * x - 3), 2 * x - 3);
+  EXPECT_EQ(IntegerPolynomial::remove_power_of_two_content(UnivariatePolynomial<boost::multiprecision::cpp_int>()), 0);
+}
+
+TEST(IntegerPolynomialTest, ExactQuotient)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(IntegerPolynomial::exact_quotient((3 * x - 2) * (x2 + 5), 3 * x - 2), x2 + 5);
+  EXPECT_EQ(IntegerPolynomial::exact_quotient(6 * x2 - 6, -2 * x + 2), -3 * x - 3);
+  EXPECT_EQ(IntegerPolynomial::exact_quotient(UnivariatePolynomial<boost::multiprecision::cpp_int>(), x - 1), 0);
+  EXPECT_FALSE(IntegerPolynomial::exact_quotient(x2 - 1, 2 * x - 2).has_value());
+  EXPECT_FALSE(IntegerPolynomial::exact_quotient(x2 + 1, x - 1).has_value());
+  EXPECT_FALSE(IntegerPolynomial::exact_quotient(x - 1, x2 - 1).has_value());
+}
+
+TEST(IntegerPolynomialTest, ComposeMobius)
+{
+  using namespace alias::monomial::integer::x;
+
+  // (x + 1)^2 ((2x + 1) / (x + 1))^2 - 2 (x + 1)^2
+  EXPECT_EQ(IntegerPolynomial::compose_mobius(x2 - 2, 2, 1, 1, 1), 2 * x2 - 1);
+  // p(1 + 2x)
+  EXPECT_EQ(IntegerPolynomial::compose_mobius(x2 - 2, 2, 1, 0, 1), 4 * x2 + 4 * x - 1);
+}
+
+TEST(IntegerPolynomialTest, SignAt)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  EXPECT_EQ(IntegerPolynomial::sign_at(x2 - 2, Q(3, 2)), 1);
+  EXPECT_EQ(IntegerPolynomial::sign_at(x2 - 2, Q(4, 3)), -1);
+  EXPECT_EQ(IntegerPolynomial::sign_at(x3 - 8, 2), 0);
+  EXPECT_EQ(IntegerPolynomial::sign_at(x3 + 1, Q(1, -2)), 1);
+  EXPECT_EQ(IntegerPolynomial::sign_at(x3 + 1, Q(3, -2)), -1);
+}
+
+TEST(IntegerPolynomialTest, SignAtWithPowerTables)
+{
+  using namespace alias::monomial::integer::x;
+
+  typedef Rational Q;
+
+  const auto [numerator_powers, denominator_powers] = IntegerPolynomial::power_tables(Q(1, -2), 3);
+
+  EXPECT_EQ(numerator_powers, std::vector<boost::multiprecision::cpp_int>({1, -1, 1, -1}));
+  EXPECT_EQ(denominator_powers, std::vector<boost::multiprecision::cpp_int>({1, 2, 4, 8}));
+
+  // Tables for degree 3 are shared by polynomials of lower degree
+  EXPECT_EQ(IntegerPolynomial::sign_at(x3 + 1, numerator_powers, denominator_powers), 1);
+  EXPECT_EQ(IntegerPolynomial::sign_at(4 * x2 - 1, numerator_powers, denominator_powers), 0);
+  EXPECT_EQ(IntegerPolynomial::sign_at(2 * x - 1, numerator_powers, denominator_powers), -1);
+  EXPECT_EQ(IntegerPolynomial::sign_at(UnivariatePolynomial<boost::multiprecision::cpp_int>(3), numerator_powers, denominator_powers), 1);
+}
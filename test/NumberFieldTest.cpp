@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <AlgebraicReal.h>
+#include <AliasMonomial.h>
+#include <NumberField.h>
+
+/*
+  Test module for NumberField.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(NumberFieldTest, Constructor)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const NumberField sqrt2_field(AlgebraicReal(x2 - 2, {1, 2}));
+
+  EXPECT_EQ(sqrt2_field.minimal_polynomial(), x2 - 2);
+  EXPECT_EQ(sqrt2_field.degree(), 2);
+  EXPECT_EQ(sqrt2_field.primitive_element(), AlgebraicReal(x2 - 2, {1, 2}));
+
+  // Minimal polynomial is the factor vanishing at the generator
+  const NumberField factored_field(AlgebraicReal((x2 - 3) * (2 * x2 - 4) * (x - 5), {1, Q(3, 2)}));
+
+  EXPECT_EQ(factored_field.minimal_polynomial(), x2 - 2);
+  EXPECT_EQ(factored_field, sqrt2_field);
+
+  const NumberField rational_field(AlgebraicReal((x2 - 3) * (x - 5), {4, 6}));
+
+  EXPECT_EQ(rational_field.minimal_polynomial(), x - 5);
+  EXPECT_EQ(rational_field.degree(), 1);
+  EXPECT_EQ(NumberField(AlgebraicReal(Q(1, 2))).minimal_polynomial(), x - Q(1, 2));
+
+  EXPECT_NE(NumberField(AlgebraicReal(x2 - 3, {1, 2})), sqrt2_field);
+  EXPECT_NE(NumberField(AlgebraicReal(x2 - 2, {-2, -1})), sqrt2_field);
+}
+
+TEST(NumberFieldTest, Element)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const NumberField field(AlgebraicReal(x2 - 2, {1, 2}));
+
+  EXPECT_EQ(field.alpha().polynomial(), x);
+  EXPECT_EQ(field.element(x3 + 1).polynomial(), 2 * x + 1);
+  EXPECT_EQ(FieldElement(field, Q(3, 4)).polynomial(), Q(3, 4));
+  EXPECT_EQ(field.element(x2).field(), field);
+
+  EXPECT_TRUE(field.element(x2).is_rational());
+  EXPECT_FALSE(field.alpha().is_rational());
+}
+
+TEST(NumberFieldTest, Arithmetic)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const NumberField field(AlgebraicReal(x2 - 2, {1, 2}));
+  const FieldElement alpha = field.alpha(), one(field, 1);
+
+  EXPECT_EQ(+alpha, alpha);
+  EXPECT_EQ(-alpha, field.element(-x));
+  EXPECT_EQ((one + alpha) * (one - alpha), FieldElement(field, -1));
+  EXPECT_EQ(alpha * alpha, FieldElement(field, 2));
+  EXPECT_EQ((one + alpha) / (one - alpha), field.element(-3 - 2 * x));
+  EXPECT_EQ(alpha / alpha, one);
+  EXPECT_NE(alpha, one);
+
+  EXPECT_EQ(alpha.inverse(), field.element(x / 2));
+  EXPECT_EQ((one + alpha).inverse(), field.element(x - 1));
+  EXPECT_THROW(FieldElement(field, 0).inverse(), std::domain_error);
+
+  EXPECT_EQ((one + alpha).pow(2), field.element(2 * x + 3));
+  EXPECT_EQ((one + alpha).pow(-1), field.element(x - 1));
+  EXPECT_EQ(alpha.pow(0), one);
+  EXPECT_EQ(alpha.pow(101), FieldElement(field, Q(boost::multiprecision::cpp_int(1) << 50, 1)) * alpha);
+
+  // Degree 3 field: 1 / (1 + a) = (a^2 - a + 1) / 3 for a^3 = 2
+  const NumberField cubic_field(AlgebraicReal(x3 - 2, {1, 2}));
+
+  EXPECT_EQ((FieldElement(cubic_field, 1) + cubic_field.alpha()).inverse(), cubic_field.element((x2 - x + 1) / 3));
+
+  const NumberField other_field(AlgebraicReal(x2 - 3, {1, 2}));
+
+  EXPECT_THROW(alpha + other_field.alpha(), std::domain_error);
+  EXPECT_THROW(alpha * other_field.alpha(), std::domain_error);
+  EXPECT_FALSE(alpha == other_field.alpha());
+}
+
+TEST(NumberFieldTest, Sign)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const NumberField field(AlgebraicReal(x2 - 2, {1, 2}));
+
+  EXPECT_EQ(field.element(x - Q(141, 100)).sign(), 1);
+  EXPECT_EQ(field.element(x - Q(142, 100)).sign(), -1);
+  EXPECT_EQ(field.element(-x).sign(), -1);
+  EXPECT_EQ(FieldElement(field, 0).sign(), 0);
+  EXPECT_EQ(FieldElement(field, Q(-1, 3)).sign(), -1);
+
+  // (sqrt(2) - 1)^40 is about 4.87 * 10^-16
+  const FieldElement small = field.element(x - 1).pow(40);
+  const Q ten_power(boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 16), 1);
+
+  EXPECT_EQ((small - FieldElement(field, 4 / ten_power)).sign(), 1);
+  EXPECT_EQ((small - FieldElement(field, 5 / ten_power)).sign(), -1);
+  EXPECT_EQ((small - FieldElement(field, 5 / ten_power)).to_algebraic_real().sign(), -1);
+}
+
+TEST(NumberFieldTest, ToAlgebraicReal)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const NumberField field(AlgebraicReal(x2 - 2, {1, 2}));
+
+  EXPECT_EQ((FieldElement(field, 1) + field.alpha()).to_algebraic_real(), AlgebraicReal(x2 - 2 * x - 1, {2, 3}));
+  EXPECT_EQ(field.element(x2 + Q(1, 2)).to_algebraic_real(), Q(5, 2));
+  EXPECT_TRUE(field.element(x2).to_algebraic_real().get_from_rational());
+
+  const NumberField cubic_field(AlgebraicReal(x3 - 2, {1, 2}));
+  const AlgebraicReal cubic_square = cubic_field.alpha().pow(2).to_algebraic_real();
+
+  EXPECT_EQ(cubic_square, AlgebraicReal(x3 - 4, {1, 2}));
+  EXPECT_EQ(cubic_square.defining_polynomial().degree(), 3);
+
+  // Same value as the arithmetic of AlgebraicReal
+  const AlgebraicReal alpha = cubic_field.primitive_element();
+
+  EXPECT_EQ((cubic_field.alpha().pow(2) - FieldElement(cubic_field, 3) * cubic_field.alpha() + FieldElement(cubic_field, 1)).to_algebraic_real(), alpha * alpha - alpha * 3 + 1);
+}
@@ -124,3 +124,26 @@ TEST(PolynomialRemainderSequenceTest, SubresultantPolynomialRemainderSequence)
   EXPECT_EQ(subresultant_PRS4.at(0), x2 + 1);
   EXPECT_EQ(subresultant_PRS4.at(1), 7);
 }
+
+TEST(PolynomialRemainderSequenceTest, SignedSubresultantPolynomialRemainderSequence)
+{
+  using namespace alias::monomial::integer::x;
+
+  // Sturm sequence over rational is x^4 - 2x^2 + 3x + 1, 4x^3 - 4x + 3, x^2 - 9/4 x - 1, -16/27 x - 1, -1
+  const auto f = x4 - 2 * x2 + 3 * x + 1;
+  const auto signed_subresultant_PRS = PolynomialRemainderSequence::signed_subresultant_polynomial_remainder_sequence(f, f.differential());
+
+  EXPECT_EQ(signed_subresultant_PRS.size(), 5);
+  EXPECT_EQ(signed_subresultant_PRS.at(0), f);
+  EXPECT_EQ(signed_subresultant_PRS.at(1), 4 * x3 - 4 * x + 3);
+  EXPECT_EQ(signed_subresultant_PRS.at(2), 16 * x2 - 36 * x - 16);
+  EXPECT_EQ(signed_subresultant_PRS.at(3).degree(), 1);
+  EXPECT_EQ(signed_subresultant_PRS.at(4).degree(), 0);
+
+  // Each term is positive multiple of the Sturm sequence term
+  EXPECT_LT(signed_subresultant_PRS.at(3).leading_coefficient(), 0);
+  EXPECT_LT(signed_subresultant_PRS.at(3).a.at(0), 0);
+  EXPECT_LT(signed_subresultant_PRS.at(4).a.at(0), 0);
+
+  EXPECT_EQ(PolynomialRemainderSequence::signed_subresultant_polynomial_remainder_sequence(x2 - 2, 0).size(), 1);
+}
@@ -186,4 +186,14 @@ TEST(RationalTest, Reduction)
 TEST(RationalTest, Power)
 {
   EXPECT_EQ(Rational(2, 3).pow(2), Rational(4, 9));
-}
\ No newline at end of file
+}
+
+TEST(RationalTest, Hash)
+{
+  std::hash<Rational> hash;
+
+  EXPECT_EQ(hash(Rational(2, 4)), hash(Rational(1, 2)));
+  EXPECT_EQ(hash(Rational(1, -2)), hash(Rational(-1, 2)));
+  EXPECT_EQ(hash(Rational(-3, -6)), hash(Rational(1, 2)));
+  EXPECT_NE(hash(Rational(1, 2)), hash(Rational(-1, 2)));
+}
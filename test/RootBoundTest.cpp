@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <AliasMonomial.h>
+#include <RootBound.h>
+
+/*
+  Test module for RootBound.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(RootBoundTest, FujiwaraExponent)
+{
+  using namespace alias::monomial::integer::x;
+
+  // roots are 1, 2, 3
+  EXPECT_EQ(RootBound::fujiwara_exponent((x - 1) * (x - 2) * (x - 3)), 4);
+  // roots are +-100i
+  EXPECT_EQ(RootBound::fujiwara_exponent(x2 + 10000), 8);
+  EXPECT_EQ(RootBound::fujiwara_exponent(x3), std::nullopt);
+  EXPECT_THROW(RootBound::fujiwara_exponent(0), std::domain_error);
+}
+
+TEST(RootBoundTest, LocalMaxExponent)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(RootBound::local_max_exponent((x - 1) * (x - 2) * (x - 3)), 4);
+  EXPECT_EQ(RootBound::local_max_exponent(-(x - 1) * (x - 2) * (x - 3)), 4);
+  EXPECT_EQ(RootBound::local_max_exponent((x + 1) * (x + 2)), std::nullopt);
+  EXPECT_EQ(RootBound::local_max_exponent(x - 1), 1);
+}
+
+TEST(RootBoundTest, PositiveRootBoundExponent)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(RootBound::positive_root_bound_exponent((x - 1) * (x - 2) * (x - 3)), 4);
+  EXPECT_EQ(RootBound::positive_root_bound_exponent((x + 1) * (x + 2)), 0);
+}
+
+TEST(RootBoundTest, NegativeRootBoundExponent)
+{
+  using namespace alias::monomial::integer::x;
+
+  EXPECT_EQ(RootBound::negative_root_bound_exponent((x + 1) * (x + 200)), 9);
+  EXPECT_EQ(RootBound::negative_root_bound_exponent((x - 1) * (x - 200)), 0);
+  // Fujiwara bound 1 hits the root -1, so the bound is doubled
+  EXPECT_EQ(RootBound::negative_root_bound_exponent(x + 1), 1);
+}
+
+TEST(RootBoundTest, PowerOfTwo)
+{
+  typedef Rational Q;
+
+  EXPECT_EQ(RootBound::power_of_two(3), 8);
+  EXPECT_EQ(RootBound::power_of_two(0), 1);
+  EXPECT_EQ(RootBound::power_of_two(-2), Q(1, 4));
+}
+
+TEST(RootBoundTest, RootBound)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  auto wilkinson = UnivariatePolynomial<Rational>(1);
+
+  for (int i = 1; i <= 20; i++)
+  {
+    wilkinson *= x - i;
+  }
+
+  // Cauchy-style bound is about 20!
+  EXPECT_GT(wilkinson.root_bound(), Rational(boost::multiprecision::cpp_int(1) << 60, 1));
+  EXPECT_TRUE(20 < RootBound::positive_root_bound(wilkinson));
+  EXPECT_TRUE(RootBound::positive_root_bound(wilkinson) <= 512);
+  EXPECT_EQ(RootBound::negative_root_bound(wilkinson), 1);
+
+  EXPECT_TRUE(Q(1, 2) < RootBound::positive_root_bound(x / 3 - Q(1, 2)));
+  EXPECT_TRUE(Q(3, 2) < RootBound::negative_root_bound(x / 3 + Q(1, 2)));
+}
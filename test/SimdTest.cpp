@@ -0,0 +1,11 @@
+#include <gtest/gtest.h>
+
+#include "BatchEvaluatorTest.cpp"
+#include "FilteredPolynomialTest.cpp"
+#include "FloatingPointHornerTest.cpp"
+
+/*
+  Test modules of floating-point evaluation, built once more for each SIMD instruction set of the host
+
+  These modules are header-only and the library is not linked, so no inline function is shared with code built for another instruction set.
+*/
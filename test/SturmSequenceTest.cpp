@@ -21,6 +21,38 @@ TEST(SturmSequenceTest, OutputStream)
   EXPECT_EQ(oss.str(), "Sturm | [1/1 3/1 -2/1 0/1 1/1] [3/1 -4/1 0/1 4/1] [-1/1 9/-4 1/1] [-16/27 -1/1] [-1/1]");
 }
 
+TEST(SturmSequenceTest, FromSignedSubresultants)
+{
+  using namespace alias::extended::rational;
+  using namespace alias::monomial::rational::x;
+  typedef Rational Q;
+
+  const auto p = x4 - 2 * x2 + 3 * x + 1;
+  const auto sturm_sequence = SturmSequence<Rational>::from_signed_subresultants(p);
+
+  EXPECT_EQ(sturm_sequence.first_term(), p);
+
+  for (const Q &r : {Q(-3), Q(-1), Q(-1, 3), Q(0), Q(1, 2), Q(2)})
+  {
+    EXPECT_EQ(sturm_sequence.count_sign_change_at(r), SturmSequence(p).count_sign_change_at(r));
+  }
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between_extended(-oo, +oo), 2);
+  EXPECT_EQ(SturmSequence<Rational>::from_signed_subresultants((x - 1) * (x - 2) * (x - 3) / 2).count_real_roots_between(0, Q(5, 2)), 2);
+}
+
+TEST(SturmSequenceTest, FirstTermSignAt)
+{
+  using namespace alias::monomial::rational::x;
+  typedef Rational Q;
+
+  SturmSequence sturm_sequence(x2 / 2 - Q(1, 3));
+
+  EXPECT_EQ(sturm_sequence.first_term_sign_at(1), 1);
+  EXPECT_EQ(sturm_sequence.first_term_sign_at(Q(1, 2)), -1);
+  EXPECT_EQ(sturm_sequence.first_term_sign_at(Q(-1, 2)), -1);
+}
+
 TEST(SturmSequenceTest, CountSignChangeAt)
 {
   using namespace alias::monomial::rational::x;
@@ -28,12 +60,78 @@ TEST(SturmSequenceTest, CountSignChangeAt)
   EXPECT_EQ(SturmSequence(x4 - 2 * x2 + 3 * x + 1).count_sign_change_at(-1), 2);
 }
 
+TEST(SturmSequenceTest, CountSignChangesAt)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  const SturmSequence sturm_sequence((x4 - 2 * x2 + 3 * x + 1) * (x - Q(1, 3)));
+  const std::vector<Rational> points({-3, -2, -1, Q(-1, 2), 0, Q(1, 3), 1, 2});
+
+  std::vector<int> expected(points.size());
+
+  std::transform(points.begin(), points.end(), expected.begin(), [&](const Rational &r)
+                 { return sturm_sequence.count_sign_change_at(r); });
+
+  EXPECT_EQ(sturm_sequence.count_sign_changes_at(points), expected);
+  EXPECT_TRUE(sturm_sequence.count_sign_changes_at({}).empty());
+}
+
+TEST(SturmSequenceTest, CountRealRootsBetweenManyIntervals)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // roots are -2, -1, 1 and 2
+  const SturmSequence sturm_sequence((x2 - 1) * (x2 - 4));
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(std::vector<std::pair<Q, Q>>({{-3, 3}, {-2, 2}, {0, 1}, {Q(-3, 2), Q(3, 2)}, {1, 2}, {3, 4}})),
+            std::vector<int>({4, 3, 1, 2, 1, 0}));
+}
+
+TEST(SturmSequenceTest, SignsAt)
+{
+  using namespace alias::monomial::rational::x;
+
+  auto signs = SturmSequence(x2 - 2).signs_at({-2, 0, 2});
+
+  ASSERT_EQ(signs.size(), 3);
+  EXPECT_EQ(signs.at(0), std::vector<int>({1, -1, 1}));
+  EXPECT_EQ(signs.at(1), std::vector<int>({-1, 0, 1}));
+  EXPECT_EQ(signs.at(2), std::vector<int>({1, 1, 1}));
+}
+
 TEST(SturmSequenceTest, CountSignChangeAtExtended)
 {
   using namespace alias::extended::rational;
   using namespace alias::monomial::rational::x;
 
   EXPECT_EQ(SturmSequence(x4 - 2 * x2 + 3 * x + 1).count_sign_change_at_extended(-oo), 3);
+  EXPECT_EQ(SturmSequence(x4 - 2 * x2 + 3 * x + 1).count_sign_change_at_extended(+oo), 1);
+  EXPECT_EQ(SturmSequence(x4 - 2 * x2 + 3 * x + 1).count_sign_change_at_extended(0), 1);
+}
+
+TEST(SturmSequenceTest, LongSequence)
+{
+  using namespace alias::extended::rational;
+  using namespace alias::monomial::rational::x;
+
+  // Wilkinson-like polynomial of degree 12 has a sequence of 13 terms
+  UnivariatePolynomial<Rational> p = 1;
+
+  for (int i = 1; i <= 12; i++)
+  {
+    p *= x - i;
+  }
+
+  const SturmSequence sturm_sequence(p);
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between_extended(-oo, +oo), 12);
+  EXPECT_EQ(sturm_sequence.count_sign_change_at_extended(-oo), 12);
+  EXPECT_EQ(sturm_sequence.count_sign_change_at_extended(+oo), 0);
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(0, Rational(13, 2)), 6);
 }
 
 TEST(SturmSequenceTest, CountRealRootBetween)
@@ -44,6 +142,37 @@ TEST(SturmSequenceTest, CountRealRootBetween)
   EXPECT_EQ(SturmSequence(x2 - 2).count_real_roots_between(0, 2), 1);
 }
 
+TEST(SturmSequenceTest, QuickReject)
+{
+  using namespace alias::monomial::rational::x;
+
+  typedef Rational Q;
+
+  // roots are -2, -1, 1 and 2
+  const SturmSequence sturm_sequence((x2 - 1) * (x2 - 4));
+
+  SturmSequence<Rational>::reset_quick_reject_counters();
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(Q(7, 5), Q(8, 5)), 0);
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(3, 4), 0);
+
+  EXPECT_EQ(SturmSequence<Rational>::quick_reject_hits(), 2);
+  EXPECT_EQ(SturmSequence<Rational>::quick_reject_misses(), 0);
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(0, 3), 2);
+  // Root at the end is not rejected
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(Q(1, 2), 1), 1);
+
+  EXPECT_EQ(SturmSequence<Rational>::quick_reject_hits(), 2);
+  EXPECT_EQ(SturmSequence<Rational>::quick_reject_misses(), 2);
+
+  // End beyond the range of double is not rejected: root 2^1000.5 is in (0, 2^1100]
+  const boost::multiprecision::cpp_int power = boost::multiprecision::cpp_int(1) << 1100;
+
+  EXPECT_EQ(SturmSequence(x2 - Q(boost::multiprecision::cpp_int(1) << 2001, 1)).count_real_roots_between(0, Q(power, 1)), 1);
+  EXPECT_EQ(SturmSequence(x2 - Q(boost::multiprecision::cpp_int(1) << 2001, 1)).count_real_roots_between(-Q(power, 1), 0), 1);
+}
+
 TEST(SturmSequenceTest, CountRealRootBetweenExtended)
 {
   using namespace alias::extended::rational;
@@ -63,3 +192,62 @@ TEST(SturmSequenceTest, NextInterval)
   EXPECT_EQ(sturm_sequence.next_interval({1, 2}).first, 1);
   EXPECT_EQ(sturm_sequence.next_interval({1, 2}).second, Q(3, 2));
 }
+
+TEST(SturmSequenceTest, NextIntervalWithSignChanges)
+{
+  using namespace alias::monomial::rational::x;
+  typedef Rational Q;
+
+  SturmSequence sturm_sequence(x2 - 2);
+
+  std::pair<Q, Q> interval = {1, 2};
+  std::pair<int, int> sign_changes = {sturm_sequence.count_sign_change_at(1), sturm_sequence.count_sign_change_at(2)};
+
+  for (int i = 0; i < 10; i++)
+  {
+    std::tie(interval, sign_changes) = sturm_sequence.next_interval(interval, sign_changes);
+
+    EXPECT_EQ(sign_changes.first, sturm_sequence.count_sign_change_at(interval.first));
+    EXPECT_EQ(sign_changes.second, sturm_sequence.count_sign_change_at(interval.second));
+    EXPECT_EQ(sign_changes.first - sign_changes.second, 1);
+  }
+
+  EXPECT_EQ(interval.second - interval.first, Q(1, 1024));
+  EXPECT_LT(interval.first * interval.first, 2);
+  EXPECT_GT(interval.second * interval.second, 2);
+}
+
+TEST(SturmSequenceTest, MemoizedCountSignChangeAt)
+{
+  using namespace alias::monomial::rational::x;
+  typedef Rational Q;
+
+  const SturmSequence sturm_sequence((x2 - 2) * (x - 3));
+  const SturmSequence copied_sturm_sequence = sturm_sequence;
+
+  for (const Q &r : {Q(-2), Q(0), Q(3, 2), Q(3), Q(6, 2), Q(-3, -1), Q(4)})
+  {
+    EXPECT_EQ(sturm_sequence.memoized_count_sign_change_at(r), sturm_sequence.count_sign_change_at(r));
+    // Copies share the cache
+    EXPECT_EQ(copied_sturm_sequence.memoized_count_sign_change_at(r), sturm_sequence.count_sign_change_at(r));
+  }
+
+  EXPECT_EQ(sturm_sequence.count_real_roots_between(-2, 4), 3);
+  EXPECT_EQ(copied_sturm_sequence.count_real_roots_between(0, 3), 2);
+
+  // The cache is allocated at the first memoized evaluation
+  const SturmSequence fresh_sturm_sequence(x2 - 2);
+  EXPECT_EQ(fresh_sturm_sequence.memoized_endpoint_count(), 0);
+
+  // Copies of a sequence with several roots share the cache even when they are made before it is used
+  const SturmSequence copied_fresh_sturm_sequence = fresh_sturm_sequence;
+  EXPECT_EQ(fresh_sturm_sequence.memoized_count_sign_change_at(1), 1);
+  EXPECT_EQ(copied_fresh_sturm_sequence.memoized_endpoint_count(), 1);
+
+  // A linear sequence is copied without the cache until it is used
+  const SturmSequence linear_sturm_sequence(x - 1);
+  const SturmSequence copied_linear_sturm_sequence = linear_sturm_sequence;
+  EXPECT_EQ(linear_sturm_sequence.memoized_count_sign_change_at(0), 1);
+  EXPECT_EQ(linear_sturm_sequence.memoized_endpoint_count(), 1);
+  EXPECT_EQ(copied_linear_sturm_sequence.memoized_endpoint_count(), 0);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <TaskPool.h>
+
+/*
+  Test module for TaskPool.h
+
+  This check all public method including overloaded operator.
+*/
+
+TEST(TaskPoolTest, Run)
+{
+  TaskPool pool(3);
+
+  EXPECT_EQ(pool.size(), 3);
+
+  std::atomic<int> sum{0};
+
+  TaskGroup group(pool);
+
+  for (int i = 1; i <= 100; i++)
+  {
+    group.run([&sum, i]
+              { sum += i; });
+  }
+
+  group.wait();
+
+  EXPECT_EQ(sum, 5050);
+}
+
+TEST(TaskPoolTest, NestedRun)
+{
+  TaskPool pool(2);
+
+  std::atomic<int> count{0};
+
+  TaskGroup outer_group(pool);
+
+  for (int i = 0; i < 8; i++)
+  {
+    outer_group.run([&pool, &count]
+                    {
+                      TaskGroup inner_group(pool);
+
+                      for (int j = 0; j < 8; j++)
+                      {
+                        inner_group.run([&count]
+                                        { count++; });
+                      }
+
+                      inner_group.wait();
+                    });
+  }
+
+  outer_group.wait();
+
+  EXPECT_EQ(count, 64);
+}
+
+TEST(TaskPoolTest, RunWithoutWorker)
+{
+  // The waiting thread runs all tasks
+  TaskPool pool(0);
+
+  int count = 0;
+
+  TaskGroup group(pool);
+
+  group.run([&count]
+            { count++; });
+  group.wait();
+
+  EXPECT_EQ(count, 1);
+}
+
+TEST(TaskPoolTest, Exception)
+{
+  TaskPool pool(2);
+
+  TaskGroup group(pool);
+
+  group.run([]
+            { throw std::domain_error("error in task"); });
+  group.run([] {});
+
+  EXPECT_THROW(group.wait(), std::domain_error);
+}
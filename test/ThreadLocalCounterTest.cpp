@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <TaskPool.h>
+#include <ThreadLocalCounter.h>
+
+/*
+  Test module for ThreadLocalCounter.h
+
+  This check all public method including overloaded operator.
+*/
+
+struct ThreadLocalCounterTestTag;
+struct ThreadLocalCounterTestOtherTag;
+
+TEST(ThreadLocalCounterTest, Increment)
+{
+  typedef ThreadLocalCounter<ThreadLocalCounterTestTag> Counter;
+
+  Counter::reset();
+
+  Counter::increment();
+  Counter::increment();
+
+  EXPECT_EQ(Counter::total(), 2);
+  // Each tag has its own counter
+  EXPECT_EQ(ThreadLocalCounter<ThreadLocalCounterTestOtherTag>::total(), 0);
+
+  // Counts of finished threads are kept
+  std::vector<std::thread> threads;
+
+  for (int i = 0; i < 4; i++)
+  {
+    threads.emplace_back([]
+                         {
+                           for (int j = 0; j < 1000; j++)
+                           {
+                             Counter::increment();
+                           }
+                         });
+  }
+
+  for (auto &each_thread : threads)
+  {
+    each_thread.join();
+  }
+
+  EXPECT_EQ(Counter::total(), 4002);
+
+  TaskPool pool(3);
+  TaskGroup group(pool);
+
+  for (int i = 0; i < 100; i++)
+  {
+    group.run([]
+              { Counter::increment(); });
+  }
+
+  group.wait();
+
+  EXPECT_EQ(Counter::total(), 4102);
+
+  Counter::reset();
+
+  EXPECT_EQ(Counter::total(), 0);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <AliasExtended.h>
+#include <AliasMonomial.h>
 #include <UnivariatePolynomial.h>
 
 /*
@@ -92,6 +93,23 @@ TEST(UnivariatePolynomialTest, POWER)
   EXPECT_EQ(p.pow(3), UnivariatePolynomial<Rational>({1, 3, 3, 1}));
 }
 
+TEST(UnivariatePolynomialTest, PowMod)
+{
+  using namespace alias::monomial::rational::x;
+
+  const boost::multiprecision::cpp_int large = boost::multiprecision::pow(boost::multiprecision::cpp_int(10), 30);
+
+  EXPECT_EQ((x + 1).pow_mod(10, x2 + 1), 32 * x);
+  EXPECT_EQ((x + 1).pow_mod(3, x5), (x + 1).pow(3));
+  EXPECT_EQ(x.pow_mod(large, x2 + 1), 1);
+  EXPECT_EQ(x.pow_mod(large + 1, x2 + 1), x);
+  EXPECT_EQ(x.pow_mod(0, x - 3), 1);
+  EXPECT_EQ((2 * x).pow_mod(100, x - 3), UnivariatePolynomial<Rational>(Rational(boost::multiprecision::pow(boost::multiprecision::cpp_int(6), 100), 1)));
+
+  EXPECT_THROW(x.pow_mod(-1, x2 + 1), std::domain_error);
+  EXPECT_THROW(x.pow_mod(2, UnivariatePolynomial<Rational>(3)), std::domain_error);
+}
+
 TEST(UnivariatePolynomialTest, OutputStream)
 {
   std::ostringstream oss;
@@ -168,6 +186,34 @@ TEST(UnivariatePolynomialTest, SquareFree)
   EXPECT_EQ(square_free(UnivariatePolynomial<Rational>({1, 1}) * UnivariatePolynomial<Rational>({1, 1}) * UnivariatePolynomial<Rational>({1, 2, 3})), UnivariatePolynomial<Rational>({1, 1}) * UnivariatePolynomial<Rational>({1, 2, 3}));
 }
 
+TEST(UnivariatePolynomialTest, CoprimeBasis)
+{
+  using namespace alias::monomial::rational::x;
+
+  // (x - 1)^2 (x + 2), (x - 1)(x - 3) and (x + 2)(x - 3)(x^2 - 2)
+  const std::vector<UnivariatePolynomial<Rational>> polynomials = {(x - 1) * (x - 1) * (x + 2), (x - 1) * (x - 3), (x + 2) * (x - 3) * (x2 - 2), 5};
+
+  const auto basis = coprime_basis(polynomials);
+
+  EXPECT_EQ(basis.size(), 4);
+
+  for (const auto &b : basis)
+  {
+    EXPECT_EQ(b.leading_coefficient(), 1);
+    EXPECT_TRUE(b == x - 1 || b == x + 2 || b == x - 3 || b == x2 - 2);
+  }
+
+  for (size_t i = 0; i < basis.size(); i++)
+  {
+    for (size_t j = i + 1; j < basis.size(); j++)
+    {
+      EXPECT_EQ(gcd(basis.at(i), basis.at(j)).degree(), 0);
+    }
+  }
+
+  EXPECT_TRUE(coprime_basis(std::vector<UnivariatePolynomial<Rational>>({1, 2})).empty());
+}
+
 TEST(UnivariatePolynomialTest, SignAt)
 {
   using namespace alias::extended::rational;